@@ -0,0 +1,278 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <functional>
+using namespace std;
+
+/*
+    Time Complexity.cpp explains the common complexity classes by counting operations on tiny
+    inputs. This program measures them instead: it runs an algorithm on inputs of growing size,
+    times each run and finds the complexity class that best explains the timings.
+
+    How it works:
+        1. Sizes grow geometrically (e.g. 1K, 2K, 4K, ...), so both small and large inputs are
+           represented and the shape of the curve is visible.
+        2. For each size, a fresh input is generated, the algorithm is run a few times untimed
+           (warm-up: caches, branch predictors, page faults) and then timed over several
+           repetitions. The median time is kept, since it is robust to scheduler noise.
+        3. Each candidate class g(n) (1, log n, n, n log n, n^2, n^3, 2^n) is fitted to the
+           timings with least squares through the origin:
+
+                time(n) ≈ c * g(n),   c = Σ t·g / Σ g²
+
+           The fit is done on relative errors (each point divided by its own time), so the
+           large sizes do not drown out the small ones.
+        4. The class with the smallest relative RMS error wins. The confidence is how much
+           better it fits than the runner-up:
+
+                confidence = 1 - bestError / secondBestError
+
+           A confidence close to 0 means two classes explain the data equally well, usually
+           because the sizes do not span a wide enough range.
+
+    Use in CI:
+        `expectComplexity` returns false when the best-fit class is worse than the expected
+        one, so an accidental O(n^2) in an O(n log n) routine fails the build; main returns 1
+        when one of its checks fails.
+
+    Limitations:
+        - Timings include noise; low-confidence results should be re-run with more repetitions.
+        - Classes that differ by a log factor (n vs n log n) need sizes spanning several
+          orders of magnitude to be told apart.
+*/
+
+/*
+    Complexity classes
+*/
+
+struct ComplexityClass {
+    string name;
+    function<double(double)> growth; // g(n)
+};
+
+vector<ComplexityClass> complexityClasses() {
+    return {
+        {"O(1)", [](double) { return 1.0; }},
+        {"O(log n)", [](double n) { return log2(n); }},
+        {"O(n)", [](double n) { return n; }},
+        {"O(n log n)", [](double n) { return n * log2(n); }},
+        {"O(n^2)", [](double n) { return n * n; }},
+        {"O(n^3)", [](double n) { return n * n * n; }},
+        {"O(2^n)", [](double n) { return pow(2.0, n); }},
+    };
+}
+
+/*
+    Profiler
+*/
+
+struct Measurement {
+    int size;
+    double seconds; // Median over the repetitions
+};
+
+struct ProfileResult {
+    vector<Measurement> measurements;
+    int bestClass;         // Index into complexityClasses()
+    string bestName;
+    double constantFactor; // c in time ≈ c * g(n), in seconds
+    double relativeError;  // RMS relative error of the best fit
+    double confidence;     // 0 (ambiguous) .. 1 (clear winner)
+};
+
+struct ProfileOptions {
+    int minSize = 1000;
+    int maxSize = 1000000;
+    double growthFactor = 2.0;
+    int warmupRuns = 2;
+    int repetitions = 5;
+};
+
+// Times `algorithm(input)` over geometric sizes and fits the timings to every complexity class
+template <typename Input, typename Generator, typename Algorithm>
+ProfileResult profileComplexity(Generator generate, Algorithm algorithm, const ProfileOptions &options) {
+    ProfileResult result;
+
+    for (double size = options.minSize; size <= options.maxSize; size *= options.growthFactor) {
+        int n = (int) size;
+        Input input = generate(n);
+
+        // Warm-up runs are not timed
+        for (int i = 0; i < options.warmupRuns; i++) {
+            Input copy = input;
+            algorithm(copy);
+        }
+
+        vector<double> times;
+        for (int i = 0; i < options.repetitions; i++) {
+            Input copy = input; // Each run gets the same untouched input (e.g. unsorted array)
+            auto start = chrono::steady_clock::now();
+            algorithm(copy);
+            auto end = chrono::steady_clock::now();
+            times.push_back(chrono::duration<double>(end - start).count());
+        }
+        sort(times.begin(), times.end());
+        result.measurements.push_back({n, max(times[times.size() / 2], 1e-9)});
+    }
+
+    // Least-squares fit of t ≈ c * g(n) on relative errors for every class
+    vector<ComplexityClass> classes = complexityClasses();
+    vector<double> errors(classes.size());
+    vector<double> constants(classes.size());
+
+    for (size_t k = 0; k < classes.size(); k++) {
+        double numerator = 0, denominator = 0;
+        for (const Measurement &m : result.measurements) {
+            double g = classes[k].growth(m.size) / m.seconds; // Scaled so every point weighs the same
+            numerator += g;                                   // Σ (t/t) * (g/t)
+            denominator += g * g;                             // Σ (g/t)^2
+        }
+        double c = (isfinite(denominator) && denominator > 0) ? numerator / denominator : 0;
+
+        double squaredError = 0;
+        for (const Measurement &m : result.measurements) {
+            double predicted = c * classes[k].growth(m.size);
+            double relative = (predicted - m.seconds) / m.seconds;
+            squaredError += relative * relative;
+        }
+        double error = sqrt(squaredError / result.measurements.size());
+        constants[k] = c;
+        errors[k] = (isfinite(error) && c > 0) ? error : INFINITY;
+    }
+
+    // Best and second-best classes
+    int best = 0;
+    for (size_t k = 1; k < classes.size(); k++) {
+        if (errors[k] < errors[best]) best = k;
+    }
+    double secondBest = INFINITY;
+    for (size_t k = 0; k < classes.size(); k++) {
+        if ((int) k != best) secondBest = min(secondBest, errors[k]);
+    }
+
+    result.bestClass = best;
+    result.bestName = classes[best].name;
+    result.constantFactor = constants[best];
+    result.relativeError = errors[best];
+    result.confidence = isfinite(secondBest) && secondBest > 0 ? 1 - errors[best] / secondBest : 1;
+    return result;
+}
+
+// Prints the measurements and the fitted class
+void printProfile(const string &name, const ProfileResult &result) {
+    cout << name << endl;
+    for (const Measurement &m : result.measurements) {
+        cout << "  n = " << m.size << ": " << m.seconds * 1e6 << " us" << endl;
+    }
+    cout << "  Best fit: " << result.bestName << ", time ≈ " << result.constantFactor * 1e9
+         << " ns * g(n), error " << result.relativeError * 100 << "%, confidence "
+         << result.confidence * 100 << "%" << endl;
+}
+
+// CI check: true when the measured class is no worse than the expected one
+bool expectComplexity(const ProfileResult &result, const string &expected) {
+    vector<ComplexityClass> classes = complexityClasses();
+    for (size_t k = 0; k < classes.size(); k++) {
+        if (classes[k].name == expected) {
+            return result.bestClass <= (int) k;
+        }
+    }
+    return false;
+}
+
+/*
+    Algorithms to profile
+*/
+
+volatile long long profileSink; // Keeps the profiled work from being optimized away
+
+// O(n): sum of the array
+void linearSum(vector<int> &arr) {
+    long long sum = 0;
+    for (int value : arr) sum += value;
+    profileSink = sum;
+}
+
+// O(log n): binary search for a missing value
+void binarySearch(vector<int> &arr) {
+    long long found = 0;
+    for (int probe = 0; probe < 64; probe++) { // A few lookups so the time is measurable
+        int left = 0, right = (int) arr.size() - 1, target = probe * 7919;
+        while (left <= right) {
+            int mid = left + (right - left) / 2;
+            if (arr[mid] == target) { found++; break; }
+            if (arr[mid] < target) left = mid + 1;
+            else right = mid - 1;
+        }
+    }
+    profileSink = found;
+}
+
+// O(n log n): library sort
+void librarySort(vector<int> &arr) {
+    sort(arr.begin(), arr.end());
+    profileSink = arr[0];
+}
+
+// O(n^2): insertion sort on random data
+void insertionSort(vector<int> &arr) {
+    for (size_t i = 1; i < arr.size(); i++) {
+        int key = arr[i];
+        size_t j = i;
+        while (j > 0 && arr[j - 1] > key) {
+            arr[j] = arr[j - 1];
+            j--;
+        }
+        arr[j] = key;
+    }
+    profileSink = arr[0];
+}
+
+int main() {
+    mt19937 rng(1);
+
+    auto randomArray = [&](int n) {
+        vector<int> arr(n);
+        for (int &value : arr) value = rng() % 1000000;
+        return arr;
+    };
+    auto sortedArray = [](int n) {
+        vector<int> arr(n);
+        for (int i = 0; i < n; i++) arr[i] = 2 * i;
+        return arr;
+    };
+
+    ProfileOptions large;
+    large.minSize = 1 << 12;
+    large.maxSize = 1 << 22;
+
+    ProfileOptions small;
+    small.minSize = 1 << 9;
+    small.maxSize = 1 << 14;
+
+    ProfileResult linear = profileComplexity<vector<int>>(randomArray, linearSum, large);
+    printProfile("Linear sum", linear);
+
+    ProfileResult search = profileComplexity<vector<int>>(sortedArray, binarySearch, large);
+    printProfile("\nBinary search", search);
+
+    ProfileResult sorting = profileComplexity<vector<int>>(randomArray, librarySort, large);
+    printProfile("\nstd::sort", sorting);
+
+    ProfileResult quadratic = profileComplexity<vector<int>>(randomArray, insertionSort, small);
+    printProfile("\nInsertion sort", quadratic);
+
+    // CI-style checks: fail when an algorithm is slower than its expected class
+    cout << "\nRegression checks" << endl;
+    bool sortingPasses = expectComplexity(sorting, "O(n log n)");
+    cout << "  std::sort within O(n log n):    " << (sortingPasses ? "PASS" : "FAIL") << endl;
+    // Demonstrates a failing check: insertion sort is O(n^2), so it does not affect the exit status
+    cout << "  Insertion sort within O(n log n): " << (expectComplexity(quadratic, "O(n log n)") ? "PASS" : "FAIL (expected, it is O(n^2))") << endl;
+
+    // A nonzero exit status fails the CI job
+    return sortingPasses ? 0 : 1;
+}
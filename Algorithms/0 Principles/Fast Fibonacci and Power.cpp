@@ -0,0 +1,266 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+using namespace std;
+
+/*
+    `fibonacciTab` in Dynamic Programming.cpp takes O(n) time and allocates an O(n) table, even
+    though every Fibonacci number only depends on the two previous ones. `power` in Recursion.cpp
+    performs one recursive call per unit of the exponent. Both can be computed in O(log n).
+
+    1. Matrix Exponentiation:
+        The Fibonacci recurrence can be written as a matrix product:
+
+            | F(n+1)  F(n)   |   =   | 1  1 | ^ n
+            | F(n)    F(n-1) |       | 1  0 |
+
+        Raising the matrix to the n-th power by repeated squaring needs O(log n) 2x2 products.
+
+    2. Fast Doubling:
+        Expanding the matrix identity gives two formulas that jump from n to 2n directly:
+
+            F(2k)     = F(k) * (2 * F(k+1) - F(k))
+            F(2k + 1) = F(k)^2 + F(k+1)^2
+
+        Walking the bits of n from the most significant one needs O(log n) steps and fewer
+        multiplications than the matrix version.
+
+    3. Compile-Time Table:
+        Only fib(0) .. fib(93) fit in 64 bits, so all of them are generated by a constexpr
+        constructor while compiling. Looking one up costs a range check and a single memory
+        read at runtime; any other n throws out_of_range instead of reading past the table.
+
+    4. Exponentiation by Squaring:
+        base^e = (base^2)^(e/2) for even e and base * base^(e-1) for odd e, so the exponent is
+        halved at every step instead of being decremented.
+
+    Time Complexity:
+        - Matrix exponentiation, fast doubling and exponentiation by squaring: O(log n).
+        - Compile-time table lookup: O(1).
+
+    Space Complexity:
+        - O(1) for every function; the compile-time table is a fixed 94 * 8 bytes.
+
+    Note:
+        - Fibonacci numbers beyond fib(93) wrap around modulo 2^64 in the uint64_t versions;
+          use the modular variants when a large n is needed (e.g. for hashing).
+*/
+
+/*
+    Compile-Time Fibonacci Table
+*/
+
+const int MAX_FIBONACCI_64 = 93; // fib(94) no longer fits in 64 bits
+
+struct FibonacciTable {
+    uint64_t values[MAX_FIBONACCI_64 + 1];
+
+    // Filled by the compiler, never at runtime
+    constexpr FibonacciTable() : values() {
+        values[1] = 1;
+        for (int i = 2; i <= MAX_FIBONACCI_64; i++) {
+            values[i] = values[i - 1] + values[i - 2];
+        }
+    }
+};
+
+constexpr FibonacciTable FIBONACCI_TABLE;
+
+static_assert(FIBONACCI_TABLE.values[MAX_FIBONACCI_64] == 12200160415121876738ULL,
+              "Compile-time Fibonacci table is wrong");
+
+// Fibonacci from the compile-time table; throws out_of_range outside 0 <= n <= 93
+uint64_t fibonacciLookup(int n) {
+    if (n < 0 || n > MAX_FIBONACCI_64) {
+        throw out_of_range("fibonacciLookup requires 0 <= n <= 93.");
+    }
+    return FIBONACCI_TABLE.values[n];
+}
+
+/*
+    Matrix Exponentiation
+*/
+
+struct Matrix2x2 {
+    uint64_t a, b, c, d; // | a b |
+                         // | c d |
+};
+
+// Product of two 2x2 matrices (modulo 2^64)
+Matrix2x2 multiply(const Matrix2x2 &x, const Matrix2x2 &y) {
+    return {
+        x.a * y.a + x.b * y.c, x.a * y.b + x.b * y.d,
+        x.c * y.a + x.d * y.c, x.c * y.b + x.d * y.d
+    };
+}
+
+// Fibonacci via 2x2 matrix power
+uint64_t fibonacciMatrix(uint64_t n) {
+    Matrix2x2 result = {1, 0, 0, 1}; // Identity matrix
+    Matrix2x2 base = {1, 1, 1, 0};   // Fibonacci Q-matrix
+
+    while (n > 0) {
+        if (n & 1) result = multiply(result, base); // Use this bit of the exponent
+        base = multiply(base, base);                // Square for the next bit
+        n >>= 1;
+    }
+    return result.b; // Q^n = | F(n+1) F(n) ; F(n) F(n-1) |
+}
+
+/*
+    Fast Doubling
+*/
+
+// Fibonacci via fast doubling (modulo 2^64)
+uint64_t fibonacciFastDoubling(uint64_t n) {
+    uint64_t fk = 0;  // F(k)
+    uint64_t fk1 = 1; // F(k+1)
+
+    // Walk the bits of n from the most significant one, building k bit by bit
+    int highestBit = n ? 63 - __builtin_clzll(n) : -1;
+    for (int bit = highestBit; bit >= 0; bit--) {
+        uint64_t f2k = fk * (2 * fk1 - fk);   // F(2k)
+        uint64_t f2k1 = fk * fk + fk1 * fk1;  // F(2k + 1)
+
+        if ((n >> bit) & 1) {
+            fk = f2k1;        // k -> 2k + 1
+            fk1 = f2k + f2k1;
+        } else {
+            fk = f2k;         // k -> 2k
+            fk1 = f2k1;
+        }
+    }
+    return fk;
+}
+
+// Fibonacci via fast doubling modulo p
+uint64_t fibonacciFastDoublingMod(uint64_t n, uint64_t p) {
+    uint64_t fk = 0;
+    uint64_t fk1 = 1 % p;
+
+    int highestBit = n ? 63 - __builtin_clzll(n) : -1;
+    for (int bit = highestBit; bit >= 0; bit--) {
+        uint64_t twiceFk1 = (2 * (unsigned __int128) fk1) % p;
+        uint64_t f2k = (unsigned __int128) fk * ((twiceFk1 + p - fk) % p) % p;
+        uint64_t f2k1 = ((unsigned __int128) fk * fk + (unsigned __int128) fk1 * fk1) % p;
+
+        if ((n >> bit) & 1) {
+            fk = f2k1;
+            fk1 = (f2k + f2k1) % p;
+        } else {
+            fk = f2k;
+            fk1 = f2k1;
+        }
+    }
+    return fk;
+}
+
+/*
+    Exponentiation by Squaring
+*/
+
+// base^exponent (modulo 2^64 on overflow) in O(log exponent)
+uint64_t powerBySquaring(uint64_t base, uint64_t exponent) {
+    uint64_t result = 1;
+    while (exponent > 0) {
+        if (exponent & 1) result *= base; // Odd exponent: take one factor out
+        base *= base;                     // Square the base
+        exponent >>= 1;                   // Halve the exponent
+    }
+    return result;
+}
+
+// base^exponent modulo p in O(log exponent)
+uint64_t powerBySquaringMod(uint64_t base, uint64_t exponent, uint64_t p) {
+    uint64_t result = 1 % p;
+    base %= p;
+    while (exponent > 0) {
+        if (exponent & 1) result = (unsigned __int128) result * base % p;
+        base = (unsigned __int128) base * base % p;
+        exponent >>= 1;
+    }
+    return result;
+}
+
+/*
+    Original implementations, kept for the benchmark
+*/
+
+// Tabulated Fibonacci (Bottom-Up) from Dynamic Programming.cpp
+int fibonacciTab(int n) {
+    if (n <= 1)
+        return n;
+    vector<int> dp(n + 1);
+    dp[0] = 0;
+    dp[1] = 1;
+    for (int i = 2; i <= n; i++) {
+        dp[i] = dp[i - 1] + dp[i - 2];
+    }
+    return dp[n];
+}
+
+// Recursive power from Recursion.cpp, with unsigned 64-bit values so that large results
+// wrap modulo 2^64 instead of overflowing a signed int (undefined behaviour)
+uint64_t power(uint64_t base, int exponent) {
+    if (exponent == 0) return 1;
+    return base * power(base, exponent - 1);
+}
+
+/*
+    Benchmark helper
+*/
+
+volatile uint64_t benchmarkSink; // Prevents the compiler from discarding benchmarked calls
+
+// Average nanoseconds per call of `function` over `calls` calls
+template <typename Function>
+double nanosecondsPerCall(Function function, int calls) {
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++) {
+        benchmarkSink = function(i);
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() / calls;
+}
+
+int main() {
+
+    // All methods agree on every value that fits in 64 bits
+    bool allMatch = true;
+    for (int n = 0; n <= MAX_FIBONACCI_64; n++) {
+        uint64_t expected = fibonacciLookup(n);
+        if (fibonacciMatrix(n) != expected || fibonacciFastDoubling(n) != expected) {
+            allMatch = false;
+        }
+    }
+    cout << "Fibonacci methods agree for n = 0.." << MAX_FIBONACCI_64 << ": " << (allMatch ? "yes" : "no") << endl;
+
+    cout << "fib(90) (lookup):        " << fibonacciLookup(90) << endl;
+    cout << "fib(90) (matrix):        " << fibonacciMatrix(90) << endl;
+    cout << "fib(90) (fast doubling): " << fibonacciFastDoubling(90) << endl;
+    cout << "fib(10^18) mod 10^9+7:   " << fibonacciFastDoublingMod(1000000000000000000ULL, 1000000007) << endl;
+
+    cout << "\n3 to the power of 4 (squaring): " << powerBySquaring(3, 4) << endl;
+    cout << "3 to the power of 40 (squaring): " << powerBySquaring(3, 40) << endl;
+    cout << "2^(10^18) mod 10^9+7:            " << powerBySquaringMod(2, 1000000000000000000ULL, 1000000007) << endl;
+
+    // Benchmark against the original O(n) implementations
+    const int CALLS = 1000000;
+    cout << "\nBenchmark (average per call, " << CALLS << " calls)\n";
+
+    // n cycles through 0..46, the range where the original int version is still exact
+    cout << "Fibonacci, n in [0, 46]" << endl;
+    cout << "  fibonacciTab (original):  " << nanosecondsPerCall([](int i) { return (uint64_t) fibonacciTab(i % 47); }, CALLS) << " ns" << endl;
+    cout << "  fibonacciMatrix:          " << nanosecondsPerCall([](int i) { return fibonacciMatrix(i % 47); }, CALLS) << " ns" << endl;
+    cout << "  fibonacciFastDoubling:    " << nanosecondsPerCall([](int i) { return fibonacciFastDoubling(i % 47); }, CALLS) << " ns" << endl;
+    cout << "  fibonacciLookup:          " << nanosecondsPerCall([](int i) { return fibonacciLookup(i % 47); }, CALLS) << " ns" << endl;
+
+    // Exponents up to 10000 show the difference between O(n) and O(log n)
+    cout << "Power, exponent in [0, 9999] (unsigned results wrap modulo 2^64, only the speed is compared)" << endl;
+    cout << "  power (original):         " << nanosecondsPerCall([](int i) { return power(3, i % 10000); }, CALLS / 100) << " ns" << endl;
+    cout << "  powerBySquaring:          " << nanosecondsPerCall([](int i) { return powerBySquaring(3, i % 10000); }, CALLS / 100) << " ns" << endl;
+
+    return 0;
+}
@@ -0,0 +1,333 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+using namespace std;
+
+/*
+    The Fibonacci and factorial functions in Dynamic Programming.cpp return `int`, so they
+    silently overflow past fib(46) and 12!, and every call allocates a fresh table that is
+    thrown away when the call returns.
+
+    This program turns them into a small numeric engine:
+
+    1. Back ends:
+        - uint64_t:          exact up to fib(93) and 20!
+        - unsigned __int128: exact up to fib(186) and 34! (GCC/Clang extension)
+        - BigInteger:        arbitrary precision, limited only by memory
+
+       The fixed-width back ends check every addition and multiplication for overflow and
+       throw `overflow_error` instead of returning a wrapped-around value.
+
+    2. Persistent memo tables:
+        - Each back end owns one process-wide table (a function-local static vector) that
+          grows on demand and is shared by every call.
+        - Asking for fib(n) after fib(m) with m >= n is a single O(1) lookup; otherwise only
+          the missing entries fib(m + 1) .. fib(n) are computed.
+
+    3. Modular variants:
+        - fibonacciMod(n, p) and factorialMod(n, p) keep one table per modulus p, so the
+          values used for hashing never grow beyond 64 bits.
+
+    Time Complexity:
+        - First call for n: O(n) additions/multiplications (O(n^2) digit operations for BigInteger).
+        - Repeated calls for any n already in the table: O(1).
+
+    Space Complexity:
+        - O(n) per back end for the memo table, kept for the lifetime of the process.
+
+    Note:
+        - The memo tables are not synchronized; guard them with a mutex before sharing the
+          engine between threads.
+*/
+
+/*
+    Arbitrary-precision unsigned integer
+
+    Digits are stored in base 10^9, least significant first, so printing is simple and
+    every product of a digit and a 32-bit multiplier fits in 64 bits.
+*/
+class BigInteger {
+private:
+    static const uint32_t BASE = 1000000000;
+    vector<uint32_t> digits; // Base 10^9 digits, least significant first
+
+public:
+    BigInteger(uint64_t value = 0) {
+        do {
+            digits.push_back(value % BASE);
+            value /= BASE;
+        } while (value > 0);
+    }
+
+    // Addition of two big integers
+    BigInteger operator+(const BigInteger &other) const {
+        BigInteger result;
+        result.digits.resize(max(digits.size(), other.digits.size()) + 1, 0);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < result.digits.size(); i++) {
+            uint64_t sum = carry;
+            if (i < digits.size()) sum += digits[i];
+            if (i < other.digits.size()) sum += other.digits[i];
+            result.digits[i] = sum % BASE;
+            carry = sum / BASE;
+        }
+        result.trim();
+        return result;
+    }
+
+    // Multiplication by a small factor (enough for factorials)
+    BigInteger operator*(uint32_t factor) const {
+        BigInteger result;
+        result.digits.assign(digits.size() + 2, 0);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < result.digits.size(); i++) {
+            uint64_t product = carry;
+            if (i < digits.size()) product += (uint64_t) digits[i] * factor;
+            result.digits[i] = product % BASE;
+            carry = product / BASE;
+        }
+        result.trim();
+        return result;
+    }
+
+    // Number of decimal digits
+    size_t length() const {
+        return toString().size();
+    }
+
+    // Decimal representation
+    string toString() const {
+        string result = to_string(digits.back());
+        for (size_t i = digits.size() - 1; i-- > 0;) {
+            string chunk = to_string(digits[i]);
+            result += string(9 - chunk.size(), '0') + chunk; // Pad inner digits to 9 characters
+        }
+        return result;
+    }
+
+private:
+    // Remove leading zero digits, keeping at least one
+    void trim() {
+        while (digits.size() > 1 && digits.back() == 0) {
+            digits.pop_back();
+        }
+    }
+};
+
+// Decimal representation of a 128-bit value
+string toString(unsigned __int128 value) {
+    if (value == 0) return "0";
+    string result;
+    while (value > 0) {
+        result.insert(result.begin(), char('0' + (int) (value % 10)));
+        value /= 10;
+    }
+    return result;
+}
+
+/*
+    Checked arithmetic
+
+    Fixed-width back ends use the compiler's overflow builtins; BigInteger never overflows.
+*/
+
+template <typename T>
+T checkedAdd(const T &a, const T &b) {
+    T result;
+    if (__builtin_add_overflow(a, b, &result)) {
+        throw overflow_error("Fibonacci value does not fit in the selected integer type.");
+    }
+    return result;
+}
+
+template <typename T>
+T checkedMultiply(const T &a, uint32_t b) {
+    T result;
+    if (__builtin_mul_overflow(a, (T) b, &result)) {
+        throw overflow_error("Factorial value does not fit in the selected integer type.");
+    }
+    return result;
+}
+
+template <>
+BigInteger checkedAdd(const BigInteger &a, const BigInteger &b) {
+    return a + b;
+}
+
+template <>
+BigInteger checkedMultiply(const BigInteger &a, uint32_t b) {
+    return a * b;
+}
+
+/*
+    Fibonacci and Factorial with persistent memo tables
+*/
+
+// Fibonacci with a process-wide memo table that grows on demand
+template <typename T>
+T fibonacci(int n) {
+    if (n < 0) {
+        throw invalid_argument("Fibonacci is not defined for negative numbers.");
+    }
+
+    static vector<T> table = {T(0), T(1)}; // Shared by every call with the same back end
+
+    // Extend the table only with the entries that are still missing
+    while ((int) table.size() <= n) {
+        size_t i = table.size();
+        table.push_back(checkedAdd(table[i - 1], table[i - 2]));
+    }
+    return table[n];
+}
+
+// Factorial with a process-wide memo table that grows on demand
+template <typename T>
+T factorial(int n) {
+    if (n < 0) {
+        throw invalid_argument("Factorial is not defined for negative numbers.");
+    }
+
+    static vector<T> table = {T(1)}; // 0! = 1
+
+    while ((int) table.size() <= n) {
+        size_t i = table.size();
+        table.push_back(checkedMultiply(table[i - 1], (uint32_t) i));
+    }
+    return table[n];
+}
+
+/*
+    Modular variants (mod p)
+
+    One table is kept per modulus. Products are taken in 128 bits so any modulus below 2^64 works.
+*/
+
+// Fibonacci(n) mod p with a persistent table per modulus
+uint64_t fibonacciMod(int n, uint64_t p) {
+    if (n < 0 || p == 0) {
+        throw invalid_argument("fibonacciMod requires n >= 0 and p > 0.");
+    }
+
+    static map<uint64_t, vector<uint64_t>> tables;
+    vector<uint64_t> &table = tables[p];
+    if (table.empty()) {
+        table = {0, 1 % p};
+    }
+
+    while ((int) table.size() <= n) {
+        size_t i = table.size();
+        uint64_t sum = table[i - 1] + table[i - 2];
+        if (sum < table[i - 1] || sum >= p) sum -= p; // Handles wrap-around for p close to 2^64
+        table.push_back(sum);
+    }
+    return table[n];
+}
+
+// Factorial(n) mod p with a persistent table per modulus
+uint64_t factorialMod(int n, uint64_t p) {
+    if (n < 0 || p == 0) {
+        throw invalid_argument("factorialMod requires n >= 0 and p > 0.");
+    }
+
+    static map<uint64_t, vector<uint64_t>> tables;
+    vector<uint64_t> &table = tables[p];
+    if (table.empty()) {
+        table = {1 % p};
+    }
+
+    while ((int) table.size() <= n) {
+        size_t i = table.size();
+        table.push_back((uint64_t) ((unsigned __int128) table[i - 1] * i % p));
+    }
+    return table[n];
+}
+
+/*
+    Original implementation from Dynamic Programming.cpp, kept for the benchmark
+*/
+
+// Tabulated Fibonacci (Bottom-Up), allocates a new table on every call
+int fibonacciTab(int n) {
+    if (n <= 1)
+        return n;
+    vector<int> dp(n + 1);
+    dp[0] = 0;
+    dp[1] = 1;
+    for (int i = 2; i <= n; i++) {
+        dp[i] = dp[i - 1] + dp[i - 2];
+    }
+    return dp[n];
+}
+
+/*
+    Benchmark helpers
+*/
+
+// Average nanoseconds per call of `function` over `calls` calls
+template <typename Function>
+double nanosecondsPerCall(Function function, int calls) {
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++) {
+        function(i);
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() / calls;
+}
+
+volatile uint64_t benchmarkSink; // Prevents the compiler from discarding benchmarked calls
+
+int main() {
+
+    // Exact values from every back end
+    cout << "Fibonacci back ends\n";
+    cout << "fib(46)  uint64_t:   " << fibonacci<uint64_t>(46) << " (int would overflow at fib(47))" << endl;
+    cout << "fib(93)  uint64_t:   " << fibonacci<uint64_t>(93) << endl;
+    cout << "fib(186) __int128:   " << toString(fibonacci<unsigned __int128>(186)) << endl;
+    cout << "fib(500) BigInteger: " << fibonacci<BigInteger>(500).toString() << endl;
+
+    cout << "\nFactorial back ends\n";
+    cout << "20!  uint64_t:   " << factorial<uint64_t>(20) << endl;
+    cout << "34!  __int128:   " << toString(factorial<unsigned __int128>(34)) << endl;
+    cout << "100! BigInteger: " << factorial<BigInteger>(100).toString() << endl;
+
+    // Overflow is reported instead of silently wrapping around
+    cout << "\nOverflow detection\n";
+    try {
+        fibonacci<uint64_t>(94);
+    } catch (const overflow_error &e) {
+        cout << "fib(94) uint64_t: " << e.what() << endl;
+    }
+    try {
+        factorial<unsigned __int128>(35);
+    } catch (const overflow_error &e) {
+        cout << "35! __int128: " << e.what() << endl;
+    }
+
+    // Modular variants for hashing workloads
+    const uint64_t MOD = 1000000007;
+    cout << "\nModular variants (mod " << MOD << ")\n";
+    cout << "fib(1000000) mod p: " << fibonacciMod(1000000, MOD) << endl;
+    cout << "1000000! mod p:     " << factorialMod(1000000, MOD) << endl;
+
+    // Per-call benchmark: the original table-per-call version against the persistent tables
+    const int CALLS = 200000;
+    cout << "\nBenchmark (average per call, " << CALLS << " calls, n cycling through its valid range)\n";
+
+    double original = nanosecondsPerCall([](int i) { benchmarkSink = fibonacciTab(i % 47); }, CALLS);
+    double memo64 = nanosecondsPerCall([](int i) { benchmarkSink = fibonacci<uint64_t>(i % 94); }, CALLS);
+    double memo128 = nanosecondsPerCall([](int i) { benchmarkSink = (uint64_t) fibonacci<unsigned __int128>(i % 187); }, CALLS);
+    double memoBig = nanosecondsPerCall([](int i) { benchmarkSink = fibonacci<BigInteger>(i % 1000).length(); }, CALLS / 100);
+    double memoMod = nanosecondsPerCall([&](int i) { benchmarkSink = fibonacciMod(i % 100000, MOD); }, CALLS);
+
+    cout << "fibonacciTab (int, new table per call): " << original << " ns" << endl;
+    cout << "fibonacci<uint64_t> (shared table):     " << memo64 << " ns" << endl;
+    cout << "fibonacci<__int128> (shared table):     " << memo128 << " ns" << endl;
+    cout << "fibonacci<BigInteger> + toString:       " << memoBig << " ns" << endl;
+    cout << "fibonacciMod (shared table):            " << memoMod << " ns" << endl;
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <vector>
+#include "Memory Accounting.h"
+using namespace std;
+
+/*
+    Space Complexity.cpp reasons about auxiliary space in comments ("4n + 12 bytes"). This
+    program measures it. Two kinds of auxiliary space are tracked:
+
+    1. Heap:
+        The global `operator new` and `operator delete` (plain, array and over-aligned forms)
+        are replaced, so every `new`, `new[]`, `std::vector` growth, `std::string`, and node
+        allocation in the program goes through a counting layer. Each block carries a small
+        header that stores its size and the region it was allocated in, so `delete` knows how
+        many bytes are released, and a block allocated before the region but freed inside it
+        is not subtracted. Tracked values:
+            - bytes allocated (total requested over the measured region)
+            - allocation count
+            - peak live heap (highest bytes simultaneously allocated by the region)
+
+    2. Stack:
+        Recursion uses stack memory instead of the heap. A `StackProbe` placed at the top of a
+        recursive function records the recursion depth and the lowest stack address reached,
+        giving the maximum depth and the number of stack bytes used.
+
+    Switching it on:
+        Accounting is off until `measureMemory` runs a region, so the counting layer costs a
+        single relaxed atomic load per allocation otherwise. The accounting lives in
+        Memory Accounting.h: to account any algorithm in the repo, include that header in its
+        file and call the algorithm through `measureMemory`.
+
+    Limitations:
+        - Only allocations through `operator new` are seen; `malloc` and `mmap` are not.
+        - Stack bytes are measured at StackProbe locations only, so a leaf function that is
+          not probed adds a few untracked bytes.
+*/
+
+/*
+    Algorithms to measure
+*/
+
+// Iterative sum: O(1) auxiliary space
+long long iterativeSum(const int *arr, int size) {
+    long long sum = 0;
+    for (int i = 0; i < size; i++) sum += arr[i];
+    return sum;
+}
+
+// Recursive sum from Recursion.cpp: O(n) auxiliary stack space
+long long arraySum(const int *arr, int size) {
+    StackProbe probe;
+    if (size == 0) return 0;
+    return arr[size - 1] + arraySum(arr, size - 1);
+}
+
+// Merge sort allocating a temporary buffer per merge: O(n) auxiliary heap, O(log n) stack
+void mergeSortRecursive(int *arr, int left, int right) {
+    StackProbe probe;
+    if (left >= right) return;
+    int mid = (left + right) / 2;
+    mergeSortRecursive(arr, left, mid);
+    mergeSortRecursive(arr, mid + 1, right);
+
+    vector<int> merged;
+    merged.reserve(right - left + 1);
+    int i = left, j = mid + 1;
+    while (i <= mid && j <= right) merged.push_back(arr[i] <= arr[j] ? arr[i++] : arr[j++]);
+    while (i <= mid) merged.push_back(arr[i++]);
+    while (j <= right) merged.push_back(arr[j++]);
+    for (int k = 0; k < (int) merged.size(); k++) arr[left + k] = merged[k];
+}
+
+// Singly linked list node from Linked List and Types.cpp
+struct SinglyNode {
+    int data;
+    SinglyNode *next;
+};
+
+// Builds and frees a list of n nodes: O(n) heap, one allocation per node
+void buildLinkedList(int n) {
+    SinglyNode *head = nullptr;
+    for (int i = 0; i < n; i++) head = new SinglyNode{i, head};
+    while (head) {
+        SinglyNode *next = head->next;
+        delete head;
+        head = next;
+    }
+}
+
+int main() {
+    const int N = 10000;
+    vector<int> arr(N);
+    for (int i = 0; i < N; i++) arr[i] = (i * 7919) % N;
+
+    long long result = 0;
+
+    printReport("Iterative sum (n = 10000)", measureMemory([&]() { result = iterativeSum(arr.data(), N); }));
+    printReport("\nRecursive arraySum (n = 10000)", measureMemory([&]() { result = arraySum(arr.data(), N); }));
+    printReport("\nMerge sort (n = 10000)", measureMemory([&]() { mergeSortRecursive(arr.data(), 0, N - 1); }));
+    printReport("\nLinked list of 10000 nodes", measureMemory([&]() { buildLinkedList(N); }));
+
+    // A buffer allocated before the region and released inside it is not counted either way
+    vector<int> *before = new vector<int>(N);
+    printReport("\nFreeing a vector allocated before the region", measureMemory([&]() { delete before; }));
+
+    // Over-aligned blocks go through the aligned operator new and are counted too
+    struct alignas(64) CacheLine { int values[16]; };
+    printReport("\nVector of 1000 64-byte aligned lines", measureMemory([&]() { vector<CacheLine> lines(1000); }));
+
+    cout << "\nsizeof(SinglyNode) = " << sizeof(SinglyNode) << " bytes, sum = " << result << endl;
+    return 0;
+}
@@ -0,0 +1,180 @@
+#ifndef MEMORY_ACCOUNTING_H
+#define MEMORY_ACCOUNTING_H
+
+#include <iostream>
+#include <new>
+#include <atomic>
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+
+/*
+    Heap and stack accounting, shared by Memory Accounting.cpp and any other program in the
+    repo. To measure an algorithm in its own file:
+
+        #include "../../0 Principles/Memory Accounting.h"   (path relative to that file)
+        ...
+        printReport("My algorithm", measureMemory([&]() { myAlgorithm(input); }));
+
+    The header replaces the global operator new and operator delete, so it must be included
+    by exactly one translation unit of a program (every program in this repo is a single
+    .cpp file). See Memory Accounting.cpp for what is tracked and how.
+*/
+
+/*
+    Heap accounting
+*/
+
+struct HeapCounters {
+    std::atomic<bool> enabled{false};
+    std::atomic<unsigned> region{0};   // Id of the region being measured, 0 outside regions
+    std::atomic<long long> bytesAllocated{0};
+    std::atomic<long long> allocationCount{0};
+    std::atomic<long long> liveBytes{0};
+    std::atomic<long long> peakLiveBytes{0};
+};
+
+inline HeapCounters heapCounters;
+
+// Header just in front of every block: where malloc's block starts, its size, and the region
+// it was allocated in, so a block from before a region is not subtracted when freed inside it
+struct AllocationHeader {
+    void *raw;
+    size_t size;
+    size_t region;
+};
+
+inline void *countedAllocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+    void *raw = malloc(sizeof(AllocationHeader) + alignment + size);
+    if (!raw) throw std::bad_alloc();
+
+    uintptr_t user = reinterpret_cast<uintptr_t>(raw) + sizeof(AllocationHeader);
+    user = (user + alignment - 1) & ~(uintptr_t) (alignment - 1);
+    AllocationHeader *header = reinterpret_cast<AllocationHeader *>(user) - 1;
+    header->raw = raw;
+    header->size = size;
+    header->region = 0;
+
+    if (heapCounters.enabled.load(std::memory_order_relaxed)) {
+        header->region = heapCounters.region.load(std::memory_order_relaxed);
+        heapCounters.bytesAllocated.fetch_add(size, std::memory_order_relaxed);
+        heapCounters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+        long long live = heapCounters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        long long peak = heapCounters.peakLiveBytes.load(std::memory_order_relaxed);
+        while (live > peak && !heapCounters.peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+    return header + 1;
+}
+
+inline void countedRelease(void *pointer) {
+    if (!pointer) return;
+    AllocationHeader *header = static_cast<AllocationHeader *>(pointer) - 1;
+    if (heapCounters.enabled.load(std::memory_order_relaxed) && header->region != 0 &&
+        header->region == heapCounters.region.load(std::memory_order_relaxed)) {
+        heapCounters.liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+    }
+    free(header->raw);
+}
+
+// Replaced global allocation functions, including the over-aligned (alignas above 16) forms;
+// the nothrow forms call these in the standard library
+void *operator new(size_t size) { return countedAllocate(size); }
+void *operator new[](size_t size) { return countedAllocate(size); }
+void *operator new(size_t size, std::align_val_t alignment) { return countedAllocate(size, (size_t) alignment); }
+void *operator new[](size_t size, std::align_val_t alignment) { return countedAllocate(size, (size_t) alignment); }
+void operator delete(void *pointer) noexcept { countedRelease(pointer); }
+void operator delete[](void *pointer) noexcept { countedRelease(pointer); }
+void operator delete(void *pointer, size_t) noexcept { countedRelease(pointer); }
+void operator delete[](void *pointer, size_t) noexcept { countedRelease(pointer); }
+void operator delete(void *pointer, std::align_val_t) noexcept { countedRelease(pointer); }
+void operator delete[](void *pointer, std::align_val_t) noexcept { countedRelease(pointer); }
+void operator delete(void *pointer, size_t, std::align_val_t) noexcept { countedRelease(pointer); }
+void operator delete[](void *pointer, size_t, std::align_val_t) noexcept { countedRelease(pointer); }
+
+/*
+    Stack accounting
+*/
+
+struct StackCounters {
+    bool enabled = false;
+    int depth = 0;
+    int maxDepth = 0;
+    uintptr_t base = 0;     // Stack address when the measurement started
+    uintptr_t lowest = 0;   // Lowest address seen (the stack grows downwards)
+};
+
+inline thread_local StackCounters stackCounters;
+
+// Place at the top of a recursive function to record its depth and stack usage
+class StackProbe {
+public:
+    StackProbe() {
+        if (!stackCounters.enabled) return;
+        char marker;
+        uintptr_t address = reinterpret_cast<uintptr_t>(&marker);
+        if (address < stackCounters.lowest) stackCounters.lowest = address;
+        stackCounters.depth++;
+        if (stackCounters.depth > stackCounters.maxDepth) stackCounters.maxDepth = stackCounters.depth;
+    }
+
+    ~StackProbe() {
+        if (stackCounters.enabled) stackCounters.depth--;
+    }
+};
+
+/*
+    Measured region
+*/
+
+struct MemoryReport {
+    long long bytesAllocated;
+    long long allocationCount;
+    long long peakHeapBytes;  // Peak live heap of blocks allocated inside the region
+    long long leakedBytes;    // Bytes allocated inside the region and still live at its end
+    int maxStackDepth;
+    long long stackBytes;
+};
+
+// Runs `function` with heap and stack accounting switched on
+template <typename Function>
+MemoryReport measureMemory(Function function) {
+    char marker;
+    stackCounters = StackCounters();
+    stackCounters.enabled = true;
+    stackCounters.base = reinterpret_cast<uintptr_t>(&marker);
+    stackCounters.lowest = stackCounters.base;
+
+    heapCounters.bytesAllocated = 0;
+    heapCounters.allocationCount = 0;
+    heapCounters.liveBytes = 0;
+    heapCounters.peakLiveBytes = 0;
+    heapCounters.region++; // Blocks from earlier regions no longer match
+    heapCounters.enabled = true;
+
+    function();
+
+    heapCounters.enabled = false;
+    stackCounters.enabled = false;
+
+    MemoryReport report;
+    report.bytesAllocated = heapCounters.bytesAllocated;
+    report.allocationCount = heapCounters.allocationCount;
+    report.peakHeapBytes = heapCounters.peakLiveBytes;
+    report.leakedBytes = heapCounters.liveBytes;
+    report.maxStackDepth = stackCounters.maxDepth;
+    report.stackBytes = stackCounters.base - stackCounters.lowest;
+    return report;
+}
+
+inline void printReport(const char *name, const MemoryReport &report) {
+    std::cout << name << std::endl;
+    std::cout << "  Heap allocated:  " << report.bytesAllocated << " bytes in " << report.allocationCount << " allocations" << std::endl;
+    std::cout << "  Peak live heap:  " << report.peakHeapBytes << " bytes" << std::endl;
+    std::cout << "  Stack depth:     " << report.maxStackDepth << " frames, " << report.stackBytes << " bytes" << std::endl;
+    if (report.leakedBytes > 0) {
+        std::cout << "  Leaked:          " << report.leakedBytes << " bytes" << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,313 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <iomanip>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+using namespace std;
+
+/*
+    Time Complexity.cpp and Space Complexity.cpp count operations by hand, but two algorithms
+    with the same Big-O can differ several times in speed because of how they use the hardware.
+    Modern CPUs expose Performance Monitoring Counters (PMCs) that count hardware events while
+    code runs. On Linux they are read through the `perf_event_open` system call.
+
+    Events collected around each algorithm call:
+        - Cycles and Instructions: their ratio (IPC, instructions per cycle) shows how well
+          the CPU pipeline is kept busy.
+        - L1 data cache misses and Last-Level Cache (LLC) misses: memory accesses that had to
+          go further down the memory hierarchy.
+        - Branch misses: mispredicted conditional jumps, each costing ~15-20 cycles.
+        - dTLB misses: address translations not cached in the TLB, common with scattered
+          accesses over large arrays.
+
+    Fallback:
+        Counters may be unavailable (non-Linux systems, containers, virtual machines, or
+        /proc/sys/kernel/perf_event_paranoid set too high). Every counter that cannot be
+        opened is reported as "n/a", and wall-clock time is always measured, so the program
+        still works everywhere.
+
+    Multiplexing:
+        When more events are requested than the CPU has hardware counters, the kernel
+        time-slices them. Each value is scaled by time_enabled / time_running to estimate the
+        full count.
+
+    Example:
+        QuickSort and Merge Sort are both O(n log n), yet their speed differs by machine. The
+        counters show where the difference comes from: QuickSort partitions in place but its
+        data-dependent comparisons cause branch misses, while Merge Sort copies every element
+        into a temporary array at each level, executing more instructions and touching more
+        memory.
+*/
+
+/*
+    Hardware counter wrapper
+*/
+
+struct CounterReading {
+    string name;
+    bool available;
+    double value;
+};
+
+class PerfCounters {
+private:
+    struct Counter {
+        string name;
+        uint32_t type;
+        uint64_t config;
+        int fd;
+    };
+    vector<Counter> counters;
+
+#ifdef __linux__
+    // Opens one counter for the calling thread, user space only; returns -1 when unavailable
+    static int openCounter(uint32_t type, uint64_t config) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+
+    static uint64_t cacheConfig(uint64_t cache, uint64_t operation, uint64_t result) {
+        return cache | (operation << 8) | (result << 16);
+    }
+#endif
+
+public:
+    PerfCounters() {
+#ifdef __linux__
+        counters = {
+            {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1},
+            {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, -1},
+            {"L1D misses", PERF_TYPE_HW_CACHE,
+                cacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS), -1},
+            {"LLC misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, -1},
+            {"branch misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, -1},
+            {"dTLB misses", PERF_TYPE_HW_CACHE,
+                cacheConfig(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS), -1},
+        };
+        for (Counter &c : counters) {
+            c.fd = openCounter(c.type, c.config);
+        }
+#else
+        counters = {
+            {"cycles", 0, 0, -1}, {"instructions", 0, 0, -1}, {"L1D misses", 0, 0, -1},
+            {"LLC misses", 0, 0, -1}, {"branch misses", 0, 0, -1}, {"dTLB misses", 0, 0, -1},
+        };
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (Counter &c : counters) {
+            if (c.fd >= 0) close(c.fd);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    // Whether at least one hardware counter could be opened
+    bool anyAvailable() const {
+        for (const Counter &c : counters) {
+            if (c.fd >= 0) return true;
+        }
+        return false;
+    }
+
+    // Resets and enables every available counter
+    void start() {
+#ifdef __linux__
+        for (Counter &c : counters) {
+            if (c.fd < 0) continue;
+            ioctl(c.fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(c.fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // Disables the counters and returns their values, scaled for multiplexing
+    vector<CounterReading> stop() {
+        vector<CounterReading> readings;
+        for (Counter &c : counters) {
+            CounterReading reading = {c.name, false, 0};
+#ifdef __linux__
+            if (c.fd >= 0) {
+                ioctl(c.fd, PERF_EVENT_IOC_DISABLE, 0);
+                uint64_t data[3] = {0, 0, 0}; // value, time enabled, time running
+                if (read(c.fd, data, sizeof(data)) == (ssize_t) sizeof(data) && data[2] > 0) {
+                    reading.available = true;
+                    reading.value = (double) data[0] * data[1] / data[2];
+                }
+            }
+#endif
+            readings.push_back(reading);
+        }
+        return readings;
+    }
+};
+
+/*
+    Measurement around any callable
+*/
+
+struct PerformanceReport {
+    double milliseconds;
+    vector<CounterReading> counters;
+};
+
+// Runs `function` once with the counters enabled and wall-clock time measured
+template <typename Function>
+PerformanceReport measure(PerfCounters &perf, Function function) {
+    PerformanceReport report;
+    perf.start();
+    auto begin = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    report.counters = perf.stop();
+    report.milliseconds = chrono::duration<double, milli>(end - begin).count();
+    return report;
+}
+
+// Value of the named counter, or -1 when it was not available
+double counterValue(const PerformanceReport &report, const string &name) {
+    for (const CounterReading &c : report.counters) {
+        if (c.name == name) return c.available ? c.value : -1;
+    }
+    return -1;
+}
+
+// Prints reports side by side, one column per algorithm
+void printReports(const vector<string> &names, const vector<PerformanceReport> &reports) {
+    cout << left << setw(16) << "";
+    for (const string &name : names) cout << right << setw(20) << name;
+    cout << endl;
+
+    cout << left << setw(16) << "time (ms)";
+    for (const PerformanceReport &r : reports) cout << right << setw(20) << fixed << setprecision(2) << r.milliseconds;
+    cout << endl;
+
+    for (size_t k = 0; k < reports[0].counters.size(); k++) {
+        cout << left << setw(16) << reports[0].counters[k].name;
+        for (const PerformanceReport &r : reports) {
+            if (r.counters[k].available) cout << right << setw(20) << fixed << setprecision(0) << r.counters[k].value;
+            else cout << right << setw(20) << "n/a";
+        }
+        cout << endl;
+    }
+
+    cout << left << setw(16) << "IPC";
+    for (const PerformanceReport &r : reports) {
+        double cycles = counterValue(r, "cycles");
+        double instructions = counterValue(r, "instructions");
+        if (cycles > 0 && instructions >= 0) cout << right << setw(20) << setprecision(2) << instructions / cycles;
+        else cout << right << setw(20) << "n/a";
+    }
+    cout << endl;
+}
+
+/*
+    Algorithms from the Sorting folder
+*/
+
+// QuickSort from Quick Sort A.cpp
+void QuickSort(int *arr, int left, int right) {
+    int leftIndex = left;
+    int rightIndex = right - 1;
+    int size = right - left;
+
+    if (size > 1) {
+        int pivot = arr[rand() % size + leftIndex];
+        while (leftIndex < rightIndex) {
+            while (arr[rightIndex] > pivot && rightIndex > leftIndex) {
+                rightIndex--;
+            }
+            while (arr[leftIndex] < pivot && leftIndex <= rightIndex) {
+                leftIndex++;
+            }
+            if (leftIndex < rightIndex) {
+                swap(arr[leftIndex], arr[rightIndex]);
+                leftIndex++;
+            }
+        }
+        QuickSort(arr, left, leftIndex);
+        QuickSort(arr, rightIndex, right);
+    }
+}
+
+// mergeHalves from Merge Sort.cpp, with a heap buffer instead of a variable-length array
+void mergeHalves(int *arr, int left, int mid, int right, vector<int> &mergedArray) {
+    int leftIndex = left;
+    int rightIndex = mid + 1;
+    int mergedIndex = 0;
+
+    while (leftIndex <= mid && rightIndex <= right) {
+        if (arr[leftIndex] <= arr[rightIndex]) {
+            mergedArray[mergedIndex++] = arr[leftIndex++];
+        } else {
+            mergedArray[mergedIndex++] = arr[rightIndex++];
+        }
+    }
+    while (leftIndex <= mid) {
+        mergedArray[mergedIndex++] = arr[leftIndex++];
+    }
+    while (rightIndex <= right) {
+        mergedArray[mergedIndex++] = arr[rightIndex++];
+    }
+    for (int i = left, j = 0; i <= right; i++, j++) {
+        arr[i] = mergedArray[j];
+    }
+}
+
+// mergeSortRecursive from Merge Sort.cpp
+void mergeSortRecursive(int *arr, int left, int right, vector<int> &buffer) {
+    if (left < right) {
+        int mid = (left + right) / 2;
+        mergeSortRecursive(arr, left, mid, buffer);
+        mergeSortRecursive(arr, mid + 1, right, buffer);
+        mergeHalves(arr, left, mid, right, buffer);
+    }
+}
+
+int main() {
+    PerfCounters perf;
+    if (!perf.anyAvailable()) {
+        cout << "Hardware counters unavailable (check perf_event_paranoid or container permissions);"
+             << " reporting wall-clock time only.\n" << endl;
+    }
+
+    const int N = 2000000;
+    mt19937 rng(3);
+    vector<int> input(N);
+    for (int &value : input) value = rng();
+
+    vector<int> quick = input;
+    vector<int> merge = input;
+    vector<int> buffer(N);
+
+    PerformanceReport quickReport = measure(perf, [&]() { QuickSort(quick.data(), 0, N); });
+    PerformanceReport mergeReport = measure(perf, [&]() { mergeSortRecursive(merge.data(), 0, N - 1, buffer); });
+
+    cout << "Sorting " << N << " random integers" << endl;
+    printReports({"QuickSort", "mergeSortRecursive"}, {quickReport, mergeReport});
+
+    cout << "\nResults match: " << (quick == merge ? "yes" : "no") << endl;
+    return 0;
+}
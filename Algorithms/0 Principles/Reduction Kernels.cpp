@@ -0,0 +1,534 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <climits>
+#include <cfloat>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+using namespace std;
+
+/*
+    `arraySum` in Recursion.cpp and `linearTimeExample` in Time Complexity.cpp add an int array
+    one element at a time into an int. That has three problems on large data:
+        - The int accumulator overflows once the sum passes about 2.1 billion.
+        - A single accumulator forms a dependency chain: each addition waits for the previous
+          one, so the CPU cannot use its SIMD units or its multiple adders.
+        - One thread cannot saturate the memory bandwidth of a multi-core machine.
+
+    This program provides reduction kernels (sum, min, max, mean, variance) that fix all three:
+
+    1. Wide, exact integer accumulation:
+        Every partial lives in a 32-bit lane and is flushed into 64- and 128-bit totals once
+        per block, so the hot loop does no 64-bit arithmetic:
+        - Sum: the values are added in wrapping 32-bit lanes next to the sum of their signed
+          high parts. A block is short enough that the sum of the low parts stays below 2^32,
+          so it is the wrapped total minus the high parts, modulo 2^32.
+        - Squares: each int is split into 11-bit pieces, x = p2 * 2^22 + p1 * 2^11 + p0, and x²
+          is a weighted sum of the piece products. Every piece fits a 16-bit lane, and one
+          pmaddwd multiplies eight of them into 32-bit sums of two products, which stay below
+          2^31 for a block: no per-element 32x32->64 multiply.
+        Neither the sum nor the sum of squares can overflow, and the variance is computed
+        exactly from Σx and Σx².
+
+    2. Compensated floating-point accumulation (Kahan):
+        Adding a small float to a large running sum loses its low-order bits. Kahan summation
+        keeps the lost part in a compensation term and adds it back on the next step, so the
+        error no longer grows with the number of elements. The variance uses the same
+        compensated sums on values shifted by the first element, which avoids the
+        cancellation of the naive Σx² - (Σx)²/n formula.
+
+    3. Independent lanes (SIMD) and prefetching:
+        Each kernel keeps its accumulators in GCC/Clang vector types, so the lanes are SIMD
+        registers without relying on autovectorization: 16-byte registers at the default -O2
+        (SSE2 on any x86-64), 32-byte ones when AVX2 is enabled (-mavx2 or -march=native).
+        Several registers per step give the adders independent work, and the loops prefetch
+        4 KB ahead so that one core keeps enough cache misses in flight to stream at the
+        memory bandwidth. The full integer kernel does the most work per byte; at SSE2, which
+        has no 32-bit min/max instruction, it is bound by instruction throughput instead.
+        Do not compile with -ffast-math: it allows the compiler to remove the Kahan
+        compensation.
+
+    4. Parallel mode:
+        The array is split into one contiguous chunk per thread. Each thread reduces its chunk
+        into a partial result, and the partials are merged: sums and extremes directly, and
+        variances with Chan's parallel formula (compile with -pthread).
+
+    Time Complexity:
+        - O(n) work, O(n / threads) time in parallel mode.
+
+    Space Complexity:
+        - O(1) per thread: a few vector registers of accumulators.
+*/
+
+const size_t BLOCK = 1 << 16;       // Elements summed in narrow lanes before flushing to wider totals
+const size_t PIECES_BLOCK = 1 << 10; // The same for the full kernel, whose square pieces are larger
+const size_t PREFETCH_BYTES = 4096;  // How far ahead of the loads the kernels prefetch
+
+// One SIMD register: 32 bytes where AVX2 is enabled (-mavx2 or -march=native), 16 otherwise
+#ifdef __AVX2__
+#define VECTOR_BYTES 32
+#else
+#define VECTOR_BYTES 16
+#endif
+typedef int IntVector __attribute__((vector_size(VECTOR_BYTES)));
+typedef unsigned UnsignedVector __attribute__((vector_size(VECTOR_BYTES)));
+typedef short ShortVector __attribute__((vector_size(VECTOR_BYTES)));
+
+const int WIDTH = VECTOR_BYTES / sizeof(int); // 32-bit lanes per vector
+const int STEP = 2 * WIDTH;                    // Elements per iteration: two vectors
+
+static IntVector loadInts(const int *p) {
+    IntVector v;
+    memcpy(&v, p, sizeof v); // Unaligned load
+    return v;
+}
+
+/*
+    Integer reduction (exact)
+*/
+
+struct IntPartial {
+    size_t count = 0;
+    __int128 sum = 0;
+    __int128 sumOfSquares = 0;
+    int minimum = INT_MAX;
+    int maximum = INT_MIN;
+};
+
+struct Statistics {
+    size_t count;
+    double sum;
+    double minimum;
+    double maximum;
+    double mean;
+    double variance; // Population variance
+};
+
+// Σ of the lanes' values from their high-half sums and wrapping value sums
+static long long flushSplitSums(IntVector high, UnsignedVector wrapped) {
+    long long total = 0;
+    for (int l = 0; l < WIDTH; l++) {
+        unsigned low = wrapped[l] - ((unsigned) high[l] << 16); // Σ of the low halves
+        total += (long long) high[l] * 65536 + low;
+    }
+    return total;
+}
+
+// Packs two vectors whose lanes fit in 16 bits into one vector of 16-bit lanes
+static ShortVector packLanes(IntVector a, IntVector b) {
+#if defined(__AVX2__)
+    return (ShortVector) _mm256_packs_epi32((__m256i) a, (__m256i) b);
+#elif defined(__SSE2__)
+    return (ShortVector) _mm_packs_epi32((__m128i) a, (__m128i) b);
+#else
+    ShortVector packed = {};
+    for (int l = 0; l < WIDTH; l++) {
+        packed[l] = (short) a[l];
+        packed[l + WIDTH] = (short) b[l];
+    }
+    return packed;
+#endif
+}
+
+// Multiplies the 16-bit lanes of `a` and `b` into 32-bit products and adds neighbouring pairs
+static IntVector multiplyAddPairs(ShortVector a, ShortVector b) {
+#if defined(__AVX2__)
+    return (IntVector) _mm256_madd_epi16((__m256i) a, (__m256i) b);
+#elif defined(__SSE2__)
+    return (IntVector) _mm_madd_epi16((__m128i) a, (__m128i) b); // pmaddwd
+#else
+    IntVector sums = {};
+    for (int l = 0; l < WIDTH; l++) sums[l] = a[2 * l] * b[2 * l] + a[2 * l + 1] * b[2 * l + 1];
+    return sums;
+#endif
+}
+
+// x = p2 * 2^22 + p1 * 2^11 + p0, with p2 in [-512, 512) and p0, p1 in [0, 2048), so
+// x² = p2² 2^44 + p2p1 2^34 + (p1² + 2 p2p0) 2^22 + p1p0 2^12 + p0²
+const int PRODUCTS = 5;
+const int PRODUCT_SHIFT[PRODUCTS] = {44, 34, 22, 12, 0};
+
+// Adds Σp2 and the piece products of the eight values in `a` and `b` into 32-bit lanes
+static void addPieces(IntVector a, IntVector b, IntVector &highPieces, IntVector products[PRODUCTS]) {
+    const ShortVector ONES = ShortVector{} + 1;
+    ShortVector p0 = packLanes(a & 0x7FF, b & 0x7FF);
+    ShortVector p1 = packLanes((a >> 11) & 0x7FF, (b >> 11) & 0x7FF);
+    ShortVector p2 = packLanes(a >> 22, b >> 22);
+    highPieces += multiplyAddPairs(p2, ONES);
+    products[0] += multiplyAddPairs(p2, p2);
+    products[1] += multiplyAddPairs(p2, p1);
+    products[2] += multiplyAddPairs(p1, p1) + multiplyAddPairs(p2, p0 + p0);
+    products[3] += multiplyAddPairs(p1, p0);
+    products[4] += multiplyAddPairs(p0, p0);
+}
+
+// Lane-wise minimum and maximum of `a` and `b` from a single compare (SSE2 has no 32-bit min)
+static void orderLanes(IntVector a, IntVector b, IntVector &lower, IntVector &upper) {
+    IntVector aAbove = a > b;
+    lower = aAbove ? b : a;
+    upper = aAbove ? a : b;
+}
+
+IntPartial reduceIntChunk(const int *data, size_t n) {
+    IntPartial partial;
+    partial.count = n;
+
+    IntVector minimum = IntVector{} + INT_MAX;
+    IntVector maximum = IntVector{} + INT_MIN;
+    long long productTotals[PRODUCTS] = {};
+    size_t vectorEnd = n - n % STEP;
+
+    for (size_t blockStart = 0; blockStart < vectorEnd; blockStart += PIECES_BLOCK) {
+        size_t blockEnd = min(vectorEnd, blockStart + PIECES_BLOCK);
+        // Each 32-bit lane gets at most PIECES_BLOCK / 8 = 128 pair products per block, each below
+        // 3 * 2^22 (p1² + 2 p2p0), so no lane reaches 2^31.
+        IntVector highPieces = {};
+        UnsignedVector wrapped = {};
+        IntVector products[PRODUCTS] = {};
+
+        for (size_t i = blockStart; i < blockEnd; i += STEP) {
+            __builtin_prefetch((const char *) (data + i) + PREFETCH_BYTES);
+            IntVector a = loadInts(data + i), b = loadInts(data + i + WIDTH);
+            wrapped += (UnsignedVector) a + (UnsignedVector) b;
+            addPieces(a, b, highPieces, products);
+            IntVector lower, upper;
+            orderLanes(a, b, lower, upper); // Three compares per two vectors instead of four
+            minimum = lower < minimum ? lower : minimum;
+            maximum = upper > maximum ? upper : maximum;
+        }
+
+        // Flush the narrow lanes into the wide totals. The block's Σ(x - p2 * 2^22) is below
+        // PIECES_BLOCK * 2^22 = 2^32, so it is the wrapped total minus 2^22 * Σp2, modulo 2^32.
+        unsigned wrappedTotal = 0;
+        long long highTotal = 0;
+        for (int l = 0; l < WIDTH; l++) {
+            wrappedTotal += wrapped[l];
+            highTotal += highPieces[l];
+        }
+        partial.sum += highTotal * (1 << 22) + (wrappedTotal - ((unsigned) highTotal << 22));
+        for (int k = 0; k < PRODUCTS; k++) {
+            for (int l = 0; l < WIDTH; l++) productTotals[k] += products[k][l];
+        }
+    }
+
+    for (int k = 0; k < PRODUCTS; k++) partial.sumOfSquares += productTotals[k] * ((__int128) 1 << PRODUCT_SHIFT[k]);
+    for (int l = 0; l < WIDTH; l++) {
+        partial.minimum = min(partial.minimum, minimum[l]);
+        partial.maximum = max(partial.maximum, maximum[l]);
+    }
+    for (size_t i = vectorEnd; i < n; i++) { // Tail elements
+        partial.sum += data[i];
+        partial.sumOfSquares += (__int128) ((long long) data[i] * data[i]);
+        partial.minimum = min(partial.minimum, data[i]);
+        partial.maximum = max(partial.maximum, data[i]);
+    }
+    return partial;
+}
+
+// Sum only, with the same split lanes: two loads, two shifts and four adds per two vectors
+long long sumInts(const int *data, size_t n) {
+    long long total = 0;
+    size_t vectorEnd = n - n % STEP;
+
+    for (size_t blockStart = 0; blockStart < vectorEnd; blockStart += BLOCK) {
+        size_t blockEnd = min(vectorEnd, blockStart + BLOCK);
+        IntVector high = {};
+        UnsignedVector wrapped = {};
+        for (size_t i = blockStart; i < blockEnd; i += STEP) {
+            __builtin_prefetch((const char *) (data + i) + PREFETCH_BYTES);
+            IntVector a = loadInts(data + i), b = loadInts(data + i + WIDTH);
+            high += (a >> 16) + (b >> 16);
+            wrapped += (UnsignedVector) a + (UnsignedVector) b;
+        }
+        total += flushSplitSums(high, wrapped);
+    }
+    for (size_t i = vectorEnd; i < n; i++) total += data[i];
+    return total; // Cannot overflow for fewer than 2^32 elements
+}
+
+IntPartial mergeIntPartials(const vector<IntPartial> &partials) {
+    IntPartial total;
+    for (const IntPartial &p : partials) {
+        total.count += p.count;
+        total.sum += p.sum;
+        total.sumOfSquares += p.sumOfSquares;
+        total.minimum = min(total.minimum, p.minimum);
+        total.maximum = max(total.maximum, p.maximum);
+    }
+    return total;
+}
+
+Statistics finishInt(const IntPartial &p) {
+    Statistics s;
+    s.count = p.count;
+    s.sum = (double) p.sum;
+    s.minimum = p.minimum;
+    s.maximum = p.maximum;
+    s.mean = p.count ? (double) ((long double) p.sum / p.count) : 0;
+    if (p.count == 0) {
+        s.variance = 0;
+    } else if (p.count <= (1u << 30)) {
+        // n * Σx² - (Σx)² is exact in 128 bits for up to 2^30 elements; divided only once
+        __int128 centered = (__int128) p.count * p.sumOfSquares - p.sum * p.sum;
+        s.variance = (double) ((long double) centered / ((long double) p.count * p.count));
+    } else {
+        long double centered = (long double) p.sumOfSquares - (long double) p.sum * p.sum / p.count;
+        s.variance = (double) (centered / p.count);
+    }
+    return s;
+}
+
+/*
+    Floating-point reduction (Kahan-compensated)
+*/
+
+template <typename Real>
+struct RealPartial {
+    size_t count = 0;
+    double mean = 0;
+    double m2 = 0; // Σ (x - mean)²
+    double sum = 0;
+    Real minimum = numeric_limits<Real>::max();
+    Real maximum = numeric_limits<Real>::lowest();
+};
+
+// Kahan step: adds `value` to `sum`, carrying the rounding error in `compensation`
+template <typename Real>
+inline void kahanAdd(Real &sum, Real &compensation, Real value) {
+    Real y = value - compensation;
+    Real t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+}
+
+template <typename Real>
+RealPartial<Real> reduceRealChunk(const Real *data, size_t n) {
+    typedef Real RealVector __attribute__((vector_size(VECTOR_BYTES)));
+    const int REAL_WIDTH = sizeof(RealVector) / sizeof(Real);
+
+    RealPartial<Real> partial;
+    partial.count = n;
+    if (n == 0) return partial;
+
+    Real shift = data[0]; // Shifting by a sample value keeps Σ(x - shift)² well conditioned
+    RealVector shiftVector = shift - RealVector{}; // shift in every lane
+    // Independent sets of vector accumulators: a Kahan step is three dependent additions, so
+    // consecutive steps on one set would wait on each other
+    const int CHAINS = 4;
+    RealVector sum[CHAINS] = {}, sumCompensation[CHAINS] = {};
+    RealVector squares[CHAINS] = {}, squaresCompensation[CHAINS] = {};
+    RealVector minimum = numeric_limits<Real>::max() - RealVector{};
+    RealVector maximum = numeric_limits<Real>::lowest() - RealVector{};
+
+    size_t i = 0;
+    for (; i + CHAINS * REAL_WIDTH <= n; i += CHAINS * REAL_WIDTH) {
+        __builtin_prefetch((const char *) (data + i) + PREFETCH_BYTES);
+        for (int v = 0; v < CHAINS; v++) {
+            RealVector x;
+            memcpy(&x, data + i + v * REAL_WIDTH, sizeof x);
+            RealVector d = x - shiftVector;
+            kahanAdd(sum[v], sumCompensation[v], d);
+            kahanAdd(squares[v], squaresCompensation[v], d * d);
+            minimum = x < minimum ? x : minimum;
+            maximum = x > maximum ? x : maximum;
+        }
+    }
+
+    // Combine the lanes in double precision
+    double shiftedSum = 0, shiftedSquares = 0;
+    for (int v = 0; v < CHAINS; v++) {
+        for (int l = 0; l < REAL_WIDTH; l++) {
+            shiftedSum += (double) sum[v][l] - (double) sumCompensation[v][l];
+            shiftedSquares += (double) squares[v][l] - (double) squaresCompensation[v][l];
+        }
+    }
+    for (int l = 0; l < REAL_WIDTH; l++) {
+        partial.minimum = min(partial.minimum, minimum[l]);
+        partial.maximum = max(partial.maximum, maximum[l]);
+    }
+    for (; i < n; i++) { // Tail elements
+        double d = (double) data[i] - shift;
+        shiftedSum += d;
+        shiftedSquares += d * d;
+        partial.minimum = min(partial.minimum, data[i]);
+        partial.maximum = max(partial.maximum, data[i]);
+    }
+
+    partial.sum = shiftedSum + (double) shift * n;
+    partial.mean = shift + shiftedSum / n;
+    partial.m2 = max(0.0, shiftedSquares - shiftedSum * shiftedSum / n);
+    return partial;
+}
+
+// Chan et al. parallel merge of means and squared deviations
+template <typename Real>
+RealPartial<Real> mergeRealPartials(const vector<RealPartial<Real>> &partials) {
+    RealPartial<Real> total;
+    for (const RealPartial<Real> &p : partials) {
+        if (p.count == 0) continue;
+        size_t count = total.count + p.count;
+        double delta = p.mean - total.mean;
+        total.m2 += p.m2 + delta * delta * ((double) total.count * p.count / count);
+        total.mean += delta * p.count / count;
+        total.sum += p.sum;
+        total.count = count;
+        total.minimum = min(total.minimum, p.minimum);
+        total.maximum = max(total.maximum, p.maximum);
+    }
+    return total;
+}
+
+template <typename Real>
+Statistics finishReal(const RealPartial<Real> &p) {
+    return {p.count, p.sum, (double) p.minimum, (double) p.maximum, p.mean, p.count ? p.m2 / p.count : 0};
+}
+
+/*
+    Single-threaded and parallel entry points
+*/
+
+// Splits [0, n) into `threads` chunks and reduces each one on its own thread
+template <typename Partial, typename Element, typename Kernel>
+vector<Partial> reduceChunksInParallel(const Element *data, size_t n, unsigned threads, Kernel kernel) {
+    threads = max(1u, min<unsigned>(threads, (unsigned) max<size_t>(1, n / BLOCK)));
+    vector<Partial> partials(threads);
+    vector<thread> workers;
+    size_t chunk = (n + threads - 1) / threads;
+
+    for (unsigned t = 0; t < threads; t++) {
+        size_t begin = min(n, t * chunk);
+        size_t end = min(n, begin + chunk);
+        workers.emplace_back([&, t, begin, end]() {
+            partials[t] = kernel(data + begin, end - begin);
+        });
+    }
+    for (thread &worker : workers) worker.join();
+    return partials;
+}
+
+Statistics reduceInts(const int *data, size_t n, unsigned threads = 1) {
+    if (threads <= 1) return finishInt(reduceIntChunk(data, n));
+    return finishInt(mergeIntPartials(reduceChunksInParallel<IntPartial>(data, n, threads, reduceIntChunk)));
+}
+
+template <typename Real>
+Statistics reduceReals(const Real *data, size_t n, unsigned threads = 1) {
+    if (threads <= 1) return finishReal(reduceRealChunk(data, n));
+    return finishReal(mergeRealPartials(reduceChunksInParallel<RealPartial<Real>>(data, n, threads, reduceRealChunk<Real>)));
+}
+
+/*
+    Original-style loops, kept for comparison
+*/
+
+// linearTimeExample without the printing: int accumulator, one element at a time
+// (added as unsigned, which wraps the way the int original does on real hardware, without
+// the undefined behaviour of signed overflow)
+int naiveIntSum(const int *arr, size_t n) {
+    unsigned sum = 0;
+    for (size_t i = 0; i < n; i++) sum += arr[i];
+    return (int) sum;
+}
+
+// Plain float accumulator
+float naiveFloatSum(const float *arr, size_t n) {
+    float sum = 0;
+    for (size_t i = 0; i < n; i++) sum += arr[i];
+    return sum;
+}
+
+/*
+    Benchmark helpers
+*/
+
+// Best-of-3 seconds for `function`
+template <typename Function>
+double bestSeconds(Function function) {
+    double best = 1e30;
+    for (int r = 0; r < 3; r++) {
+        auto start = chrono::steady_clock::now();
+        function();
+        auto end = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double>(end - start).count());
+    }
+    return best;
+}
+
+// Decimal digits of a 128-bit integer (iostream has no operator for __int128)
+string int128ToString(__int128 value) {
+    if (value == 0) return "0";
+    bool negative = value < 0;
+    unsigned __int128 magnitude = negative ? -(unsigned __int128) value : (unsigned __int128) value;
+    string digits;
+    while (magnitude) {
+        digits += char('0' + (int) (magnitude % 10));
+        magnitude /= 10;
+    }
+    if (negative) digits += '-';
+    return string(digits.rbegin(), digits.rend());
+}
+
+void printStatistics(const char *name, const Statistics &s) {
+    cout << name << ": sum " << s.sum << ", min " << s.minimum << ", max " << s.maximum
+         << ", mean " << s.mean << ", variance " << s.variance << endl;
+}
+
+// Integer statistics, with the exact 128-bit sum printed as an integer rather than a double
+void printStatistics(const char *name, const IntPartial &partial) {
+    Statistics s = finishInt(partial);
+    cout << name << ": sum " << int128ToString(partial.sum) << ", min " << s.minimum << ", max " << s.maximum
+         << ", mean " << s.mean << ", variance " << s.variance << endl;
+}
+
+volatile double reductionSink; // Keeps benchmarked results alive
+
+int main() {
+    cout.precision(12);
+
+    const size_t N = 40000000; // 160 MB per array, larger than any cache
+    unsigned threads = max(1u, thread::hardware_concurrency());
+
+    mt19937 rng(11);
+    vector<int> ints(N);
+    for (int &x : ints) x = (int) (rng() % 2000001) - 1000000 + 1000000000; // Large values overflow int sums
+    vector<float> floats(N);
+    for (float &x : floats) x = 1000.0f + (rng() % 1000) / 1000.0f;
+
+    // Accuracy
+    cout << "Accuracy on " << N << " elements" << endl;
+    cout << "Naive int sum (overflows):   " << naiveIntSum(ints.data(), N) << endl;
+    cout << "Split-lane sum:              " << sumInts(ints.data(), N) << endl;
+    printStatistics("Exact int reduction        ", reduceIntChunk(ints.data(), N));
+    cout << "Naive float sum:             " << naiveFloatSum(floats.data(), N) << endl;
+    printStatistics("Kahan float reduction      ", reduceReals(floats.data(), N));
+    printStatistics("Kahan float (parallel)     ", reduceReals(floats.data(), N, threads));
+
+    // Throughput; compare GB/s with the machine's STREAM read bandwidth
+    double bytes = (double) N * sizeof(int);
+    cout << "\nThroughput (" << threads << " hardware threads, " << bytes / 1e6 << " MB per array)" << endl;
+
+    double naiveInt = bestSeconds([&]() { reductionSink = naiveIntSum(ints.data(), N); });
+    double sumOnly = bestSeconds([&]() { reductionSink = sumInts(ints.data(), N); });
+    double laneInt = bestSeconds([&]() { reductionSink = reduceInts(ints.data(), N).variance; });
+    double parallelInt = bestSeconds([&]() { reductionSink = reduceInts(ints.data(), N, threads).variance; });
+    double naiveFloat = bestSeconds([&]() { reductionSink = naiveFloatSum(floats.data(), N); });
+    double laneFloat = bestSeconds([&]() { reductionSink = reduceReals(floats.data(), N).variance; });
+    double parallelFloat = bestSeconds([&]() { reductionSink = reduceReals(floats.data(), N, threads).variance; });
+
+    cout << "Naive int sum:                  " << bytes / naiveInt / 1e9 << " GB/s" << endl;
+    cout << "Split-lane int sum:             " << bytes / sumOnly / 1e9 << " GB/s" << endl;
+    cout << "Int sum/min/max/variance:       " << bytes / laneInt / 1e9 << " GB/s" << endl;
+    cout << "Int, parallel:                  " << bytes / parallelInt / 1e9 << " GB/s" << endl;
+    cout << "Naive float sum:                " << bytes / naiveFloat / 1e9 << " GB/s" << endl;
+    cout << "Kahan float sum/min/max/var:    " << bytes / laneFloat / 1e9 << " GB/s" << endl;
+    cout << "Kahan float, parallel:          " << bytes / parallelFloat / 1e9 << " GB/s" << endl;
+
+    return 0;
+}
@@ -32,12 +32,23 @@ int main(void) {
     // Therefore, the total space usage is 4n + 12 bytes.
     // Since n is the largest term in this equation, the overall space complexity is O(n) (linear).
     int n, i, sum = 0;
-    cin >> n;
+
+    // Validate the size before allocating: a failed read, a negative value or a huge value
+    // would otherwise be passed straight to new[].
+    const int MAX_ELEMENTS = 1000000;
+    if (!(cin >> n) || n <= 0 || n > MAX_ELEMENTS) {
+        cout << "Invalid array size, expected 1 to " << MAX_ELEMENTS << "." << endl;
+        return 1;
+    }
 
     // Dynamically allocate an array of size n
     int* dynArr = new int[n];
     for(i = 0; i < n; i++) {
-        cin >> dynArr[i];
+        if (!(cin >> dynArr[i])) {
+            cout << "Invalid array element." << endl;
+            delete[] dynArr;
+            return 1;
+        }
         sum += dynArr[i];
     }
 
@@ -0,0 +1,414 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+using namespace std;
+
+/*
+    Recursion.cpp notes that deep recursion may overflow the stack. Each call of `arraySum`
+    pushes a frame of a few dozen bytes, so on a 10M-element array it needs hundreds of MB of
+    stack, far beyond the usual 8 MB limit. The same risk exists in every recursive routine
+    whose depth grows with the input: `binarySearchRecursive` (shallow, but recursive),
+    `mergeSortRecursive` (shallow, but its merge buffer is a variable-length array on the
+    stack) and the tree functions `insert`, `print` and `deleteTree` (depth n on a degenerate,
+    sorted-insert tree).
+
+    This program provides two small engines that move recursion off the call stack:
+
+    1. Trampoline (for tail recursion):
+        A recursive call that is the last thing a function does (a tail call) needs no frame,
+        since nothing is left to do after it returns. Non-tail recursions such as
+        `arr[size - 1] + arraySum(arr, size - 1)` become tail recursions by carrying the
+        partial result in an accumulator. The step function then either overwrites the state
+        with the arguments of the next call, or stores the result and reports that it is
+        finished, and `trampoline` loops until it is. The state is a plain struct updated in
+        place, nothing is allocated and the step is inlined, so GCC -O2 emits the same loop
+        for arraySumStackSafe as for the recursive arraySum (which it turns into a loop too).
+
+    2. Explicit Stack (for general recursion):
+        Calls that must do work after a recursive call returns (merge sort merges after both
+        halves are sorted, the tree printer prints a node between its subtrees) keep their
+        pending work in frames on a heap-allocated `ExplicitStack`: plain structs in one
+        array, pushed and popped by index, with the step inlined into the loop. A frame
+        records which stage of the function it resumes at. The heap stack grows as needed,
+        so the depth is limited only by memory.
+
+    Time Complexity:
+        - Same as the recursive originals.
+
+    Space Complexity:
+        - Trampoline: O(1).
+        - Explicit stack: the same number of frames as the recursion, but on the heap and
+          typically smaller, since only the needed fields are stored.
+*/
+
+/*
+    Trampoline engine
+*/
+
+// Runs `step(state, result)` until it returns true. A step that makes a tail call overwrites
+// `state` with the arguments of the next call and returns false; a finished step stores
+// `result` and returns true. The state stays in registers and the step is inlined, so the
+// loop compiles to the same code as a hand-written while loop.
+template <typename Result, typename State, typename Step>
+Result trampoline(State state, Step step) {
+    Result result{};
+    while (!step(state, result)) {
+    }
+    return result;
+}
+
+/*
+    Explicit stack engine
+*/
+
+// Frames are plain structs in one growable array; push and pop are an index update and a copy
+template <typename Frame>
+class ExplicitStack {
+private:
+    vector<Frame> frames;
+    size_t top = 0;
+    size_t maxDepth = 0;
+
+public:
+    ExplicitStack() : frames(64) {}
+
+    void push(const Frame &frame) {
+        if (top == frames.size()) frames.resize(frames.size() * 2);
+        frames[top++] = frame;
+        if (top > maxDepth) maxDepth = top;
+    }
+
+    Frame pop() { return frames[--top]; }
+
+    bool isEmpty() const { return top == 0; }
+    size_t deepest() const { return maxDepth; }
+};
+
+// Runs `step(frame, stack)` until no frames are left; `step` may push follow-up frames.
+// `step` is a template parameter, so it is inlined into the loop rather than called indirectly.
+template <typename Frame, typename Step>
+size_t runOnExplicitStack(const Frame &root, Step step) {
+    ExplicitStack<Frame> stack;
+    stack.push(root);
+    while (!stack.isEmpty()) {
+        Frame frame = stack.pop();
+        step(frame, stack);
+    }
+    return stack.deepest(); // Maximum depth reached, for reporting
+}
+
+/*
+    Recursion.cpp: factorial, arraySum and power on the trampoline
+*/
+
+struct FactorialState {
+    int n;
+    uint64_t accumulator;
+};
+
+uint64_t factorialStackSafe(int n) {
+    return trampoline<uint64_t>(FactorialState{n, 1}, [](FactorialState &s, uint64_t &result) {
+        if (s.n <= 1) {
+            result = s.accumulator;
+            return true;
+        }
+        s = {s.n - 1, s.accumulator * s.n};
+        return false;
+    });
+}
+
+struct ArraySumState {
+    const int *arr;
+    int size;
+    long long accumulator; // 64-bit: the int sum of 10M elements would overflow
+};
+
+long long arraySumStackSafe(const int *arr, int size) {
+    return trampoline<long long>(ArraySumState{arr, size, 0}, [](ArraySumState &s, long long &result) {
+        if (s.size == 0) {
+            result = s.accumulator;
+            return true;
+        }
+        s = {s.arr, s.size - 1, s.accumulator + s.arr[s.size - 1]};
+        return false;
+    });
+}
+
+struct PowerState {
+    long long base;
+    int exponent;
+    long long accumulator;
+};
+
+long long powerStackSafe(long long base, int exponent) {
+    return trampoline<long long>(PowerState{base, exponent, 1}, [](PowerState &s, long long &result) {
+        if (s.exponent == 0) {
+            result = s.accumulator;
+            return true;
+        }
+        s = {s.base, s.exponent - 1, s.accumulator * s.base};
+        return false;
+    });
+}
+
+/*
+    Binary Search.cpp: binarySearchRecursive is already tail recursive
+*/
+
+struct SearchState {
+    int left, right;
+};
+
+int binarySearchStackSafe(const int *arr, int size, int target) {
+    return trampoline<int>(SearchState{0, size - 1}, [&](SearchState &s, int &result) {
+        if (s.left > s.right) {
+            result = -1;
+            return true;
+        }
+        int mid = s.left + (s.right - s.left) / 2;
+        if (arr[mid] == target) {
+            result = mid;
+            return true;
+        }
+        if (arr[mid] < target) s.left = mid + 1;
+        else s.right = mid - 1;
+        return false;
+    });
+}
+
+/*
+    Merge Sort.cpp: mergeSortRecursive on the explicit stack, merge buffer on the heap
+*/
+
+struct MergeFrame {
+    int left, right;
+    bool halvesSorted; // false: split into halves; true: merge the sorted halves
+};
+
+// Merges the sorted runs arr[left..mid] and arr[mid+1..right] through `buffer`; shared with
+// the recursive original below, so the two sorts differ only in how they reach each merge
+void mergeHalves(int *arr, int left, int mid, int right, int *buffer) {
+    int i = left, j = mid + 1, k = 0;
+    while (i <= mid && j <= right) buffer[k++] = arr[i] <= arr[j] ? arr[i++] : arr[j++];
+    while (i <= mid) buffer[k++] = arr[i++];
+    while (j <= right) buffer[k++] = arr[j++];
+    copy(buffer, buffer + k, arr + left);
+}
+
+void mergeSortStackSafe(int *arr, int size) {
+    if (size < 2) return;
+    vector<int> buffer(size); // One heap buffer instead of a stack array per merge
+
+    runOnExplicitStack<MergeFrame>({0, size - 1, false}, [&](const MergeFrame &frame, ExplicitStack<MergeFrame> &stack) {
+        MergeFrame f = frame;
+
+        if (!f.halvesSorted) {
+            // Walk down the left halves directly, leaving each merge and right half on the stack
+            // (merge below right half, so the right half is sorted first). Single elements are
+            // already sorted, so they get no frame.
+            while (f.left < f.right) {
+                int mid = (f.left + f.right) / 2;
+                stack.push({f.left, f.right, true});
+                if (mid + 1 < f.right) stack.push({mid + 1, f.right, false});
+                f.right = mid;
+            }
+            return;
+        }
+
+        mergeHalves(arr, f.left, (f.left + f.right) / 2, f.right, buffer.data());
+    });
+}
+
+/*
+    Binary Search Tree.cpp: insert, print and deleteTree without recursion
+*/
+
+class Node {
+    public:
+        int data;
+        Node* left;
+        Node* right;
+
+        Node(int val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+// Insert is tail recursive: walk down to the empty link and attach the new node there
+Node* insertStackSafe(Node* root, int val) {
+    Node** link = &root;
+    while (*link) {
+        link = val < (*link)->data ? &(*link)->left : &(*link)->right;
+    }
+    *link = new Node(val);
+    return root;
+}
+
+struct PrintFrame {
+    Node* node;
+    int space;
+    int type;
+    bool rightDone; // false: visit the right subtree first; true: print node, then left subtree
+};
+
+// Rotated 2D view, same output as the recursive print
+void printStackSafe(Node* root) {
+    const int INDENT = 3;
+    if (!root) return;
+
+    runOnExplicitStack<PrintFrame>({root, INDENT, 0, false}, [&](const PrintFrame &f, ExplicitStack<PrintFrame> &stack) {
+        if (!f.rightDone) {
+            // Pushed in reverse: right subtree, then this node, then (from the node) the left subtree
+            stack.push({f.node, f.space, f.type, true});
+            if (f.node->right) stack.push({f.node->right, f.space + INDENT, 1, false});
+            return;
+        }
+
+        for (int i = INDENT; i < f.space; ++i) cout << " ";
+        if (f.type == 1) cout << "/ " << f.node->data << endl;
+        else if (f.type == 2) cout << "\\ " << f.node->data << endl;
+        else cout << f.node->data << endl;
+
+        if (f.node->left) stack.push({f.node->left, f.space + INDENT, 2, false});
+    });
+}
+
+// Deletion order does not matter once the children are remembered, so no post-order stage is needed
+size_t deleteTreeStackSafe(Node* root) {
+    if (!root) return 0;
+    return runOnExplicitStack<Node*>(root, [](Node* node, ExplicitStack<Node*> &stack) {
+        if (node->left) stack.push(node->left);
+        if (node->right) stack.push(node->right);
+        delete node;
+    });
+}
+
+/*
+    Recursive originals, kept for the throughput comparison
+*/
+
+long long arraySum(const int *arr, int size) {
+    if (size == 0) return 0;
+    return arr[size - 1] + arraySum(arr, size - 1);
+}
+
+int binarySearchRecursive(const int *arr, int left, int right, int target) {
+    if (left <= right) {
+        int mid = left + (right - left) / 2;
+        if (arr[mid] == target) return mid;
+        else if (arr[mid] < target) return binarySearchRecursive(arr, mid + 1, right, target);
+        else return binarySearchRecursive(arr, left, mid - 1, target);
+    }
+    return -1;
+}
+
+void mergeSortRecursive(int *arr, int left, int right, vector<int> &buffer) {
+    if (left >= right) return;
+    int mid = (left + right) / 2;
+    mergeSortRecursive(arr, left, mid, buffer);
+    mergeSortRecursive(arr, mid + 1, right, buffer);
+    mergeHalves(arr, left, mid, right, buffer.data());
+}
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main() {
+    const int ROUNDS = 5;
+
+    // Same results as Recursion.cpp
+    int small[] = {1, 2, 3, 4, 5};
+    cout << "Factorial of 5: " << factorialStackSafe(5) << endl;
+    cout << "Sum of array elements: " << arraySumStackSafe(small, 5) << endl;
+    cout << "3 to the power of 4: " << powerStackSafe(3, 4) << endl;
+
+    // Same output as Binary Search Tree.cpp
+    Node* root = nullptr;
+    int values[] = {5, 3, 8, 1, 4, 7, 9, 0, 2, 6, 10};
+    for (int val : values) root = insertStackSafe(root, val);
+    cout << "\nBinary Search Tree:\n";
+    printStackSafe(root);
+    deleteTreeStackSafe(root);
+
+    // Deep inputs that overflow an 8 MB call stack when run recursively
+    const int DEEP = 10000000;
+    vector<int> big(DEEP, 1);
+    cout << "\nDeep inputs" << endl;
+    cout << "arraySumStackSafe on " << DEEP << " elements: " << arraySumStackSafe(big.data(), DEEP) << endl;
+
+    // A sorted-insert BST degenerates into a chain; linked directly to avoid O(n^2) inserts
+    const int CHAIN = 1000000;
+    Node* chain = new Node(0);
+    Node* tail = chain;
+    for (int i = 1; i < CHAIN; i++) {
+        tail->right = new Node(i);
+        tail = tail->right;
+    }
+    chain = insertStackSafe(chain, CHAIN); // Walks the full depth
+    cout << "deleteTreeStackSafe on a chain of depth " << CHAIN + 1 << ": max explicit stack "
+         << deleteTreeStackSafe(chain) << " frames" << endl;
+
+    // Throughput against the recursive originals, on sizes the call stack can still handle.
+    // Each pair runs interleaved ROUNDS times and the best time of each is kept, so one slow
+    // round (another process, a page fault) does not decide the comparison.
+    cout << "\nThroughput (recursive vs stack-safe, best of " << ROUNDS << ")" << endl;
+
+    const int SUM_SIZE = 50000;
+    const int SUM_REPEATS = 2000;
+    long long sink = 0;
+    // Both sums are called through the same pointer so neither is inlined into this loop;
+    // inlined, GCC vectorizes whichever one it happens to inline and times that instead
+    long long (*volatile sumFunction)(const int *, int);
+    double recursiveSum = 1e300, safeSum = 1e300;
+    for (int round = 0; round < ROUNDS; round++) {
+        sumFunction = arraySum;
+        recursiveSum = min(recursiveSum, millisecondsFor([&]() {
+            for (int r = 0; r < SUM_REPEATS; r++) sink += sumFunction(big.data() + r, SUM_SIZE);
+        }));
+        sumFunction = arraySumStackSafe;
+        safeSum = min(safeSum, millisecondsFor([&]() {
+            for (int r = 0; r < SUM_REPEATS; r++) sink += sumFunction(big.data() + r, SUM_SIZE);
+        }));
+    }
+    cout << "arraySum (" << SUM_SIZE << " elements x " << SUM_REPEATS << "): " << recursiveSum << " ms recursive, "
+         << safeSum << " ms stack-safe" << endl;
+
+    vector<int> sorted(1000000);
+    for (int i = 0; i < (int) sorted.size(); i++) sorted[i] = 2 * i;
+    const int SEARCHES = 2000000;
+    double recursiveSearch = 1e300, safeSearch = 1e300;
+    for (int round = 0; round < ROUNDS; round++) {
+        recursiveSearch = min(recursiveSearch, millisecondsFor([&]() {
+            for (int r = 0; r < SEARCHES; r++) sink += binarySearchRecursive(sorted.data(), 0, (int) sorted.size() - 1, (int) ((r * 7919LL) % 2000000));
+        }));
+        safeSearch = min(safeSearch, millisecondsFor([&]() {
+            for (int r = 0; r < SEARCHES; r++) sink += binarySearchStackSafe(sorted.data(), (int) sorted.size(), (int) ((r * 7919LL) % 2000000));
+        }));
+    }
+    cout << "binarySearch (" << SEARCHES << " lookups): " << recursiveSearch << " ms recursive, "
+         << safeSearch << " ms stack-safe" << endl;
+
+    mt19937 rng(5);
+    vector<int> unsorted(2000000);
+    for (int &value : unsorted) value = rng();
+    vector<int> a, b, buffer(unsorted.size());
+    double recursiveSort = 1e300, safeSort = 1e300;
+    for (int round = 0; round < ROUNDS; round++) {
+        a = unsorted;
+        b = unsorted;
+        recursiveSort = min(recursiveSort, millisecondsFor([&]() { mergeSortRecursive(a.data(), 0, (int) a.size() - 1, buffer); }));
+        safeSort = min(safeSort, millisecondsFor([&]() { mergeSortStackSafe(b.data(), (int) b.size()); }));
+    }
+    cout << "mergeSort (" << unsorted.size() << " elements): " << recursiveSort << " ms recursive, "
+         << safeSort << " ms stack-safe" << (a == b ? "" : " MISMATCH") << endl;
+
+    cout << "(checksum " << sink << ")" << endl;
+    return 0;
+}
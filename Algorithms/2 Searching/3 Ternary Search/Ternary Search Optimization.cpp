@@ -0,0 +1,229 @@
+#include <iostream>
+#include <cmath>
+#include <limits>
+using namespace std;
+
+/*
+    Ternary Search on a sorted array (see Ternary Search.cpp) is never better than Binary Search:
+    it performs more comparisons per level and gains nothing from the third part. The real use
+    case for ternary search is finding the extremum of a unimodal function, i.e. a function that
+    strictly decreases up to its minimum and strictly increases after it (or the opposite for a
+    maximum). Binary search cannot be used here because a single probe does not tell in which
+    direction the minimum lies; two probes do.
+
+    When each evaluation of the function is expensive (e.g. a simulation run), the number of
+    evaluations matters far more than the loop overhead, so every optimizer in this file counts
+    them through the `evaluations` parameter.
+
+    Optimizers:
+        1. Classic Ternary Search (integer and floating-point):
+           Probes two points at 1/3 and 2/3 of the range and discards one third.
+           Uses 2 evaluations per step and shrinks the range by a factor of 2/3.
+
+        2. Golden-Section Search (floating-point):
+           Places the probes at the golden ratio so that one of the two probes of the next step
+           is exactly a probe of the current step. Only 1 new evaluation per step, and the range
+           shrinks by a factor of 0.618 per evaluation.
+
+        3. Fibonacci Search (integer):
+           The discrete counterpart of golden-section search. The range is padded to a Fibonacci
+           length F(k) so that every probe lands on an integer and one probe is reused per step.
+           It is the optimal strategy for a fixed number of evaluations.
+
+    Evaluations needed to shrink a range of length n down to a single point:
+        - Ternary Search:        ~2 * log_{3/2}(n) ≈ 3.42 * log2(n)
+        - Golden-Section Search: ~log_{1.618}(n)   ≈ 1.44 * log2(n)
+        - Fibonacci Search:      ~log_{1.618}(n)   ≈ 1.44 * log2(n)
+
+    Time Complexity:
+        - O(log n) evaluations for every optimizer.
+
+    Space Complexity:
+        - O(1), all optimizers are iterative.
+
+    Pros:
+        - Find the extremum without derivatives.
+        - Golden-section and Fibonacci search need less than half the evaluations of ternary search.
+
+    Cons:
+        - Only correct for unimodal functions; a plateau or a second local minimum can mislead them.
+
+    Note:
+        - All optimizers search for a minimum. To find a maximum, pass the negated function.
+*/
+
+// Classic Ternary Search for the minimum of a unimodal function over the integers [left, right]
+template <typename Function>
+long long ternarySearchMinInt(Function f, long long left, long long right, int &evaluations) {
+    while (right - left > 2) {
+        long long mid1 = left + (right - left) / 3; // Calculate first probe
+        long long mid2 = right - (right - left) / 3; // Calculate second probe
+        evaluations += 2;
+
+        if (f(mid1) < f(mid2)) {
+            right = mid2 - 1; // Minimum cannot be at or right of mid2
+        } else {
+            left = mid1 + 1; // Minimum cannot be at or left of mid1
+        }
+    }
+
+    // At most three candidates remain, check them directly
+    long long best = left;
+    double bestValue = f(left);
+    evaluations++;
+    for (long long x = left + 1; x <= right; x++) {
+        double value = f(x);
+        evaluations++;
+        if (value < bestValue) {
+            best = x;
+            bestValue = value;
+        }
+    }
+    return best;
+}
+
+// Classic Ternary Search for the minimum of a unimodal function over the reals [left, right]
+template <typename Function>
+double ternarySearchMin(Function f, double left, double right, double tolerance, int &evaluations) {
+    while (right - left > tolerance) {
+        double mid1 = left + (right - left) / 3;
+        double mid2 = right - (right - left) / 3;
+        evaluations += 2;
+
+        if (f(mid1) < f(mid2)) {
+            right = mid2;
+        } else {
+            left = mid1;
+        }
+    }
+    return (left + right) / 2;
+}
+
+// Golden-Section Search for the minimum of a unimodal function over the reals [left, right]
+template <typename Function>
+double goldenSectionSearchMin(Function f, double left, double right, double tolerance, int &evaluations) {
+    const double invPhi = (sqrt(5.0) - 1) / 2; // 1 / golden ratio ≈ 0.618
+
+    double probe1 = right - invPhi * (right - left);
+    double probe2 = left + invPhi * (right - left);
+    double value1 = f(probe1);
+    double value2 = f(probe2);
+    evaluations += 2;
+
+    while (right - left > tolerance) {
+        if (value1 < value2) {
+            // Keep [left, probe2]; the old probe1 becomes the new probe2
+            right = probe2;
+            probe2 = probe1;
+            value2 = value1;
+            probe1 = right - invPhi * (right - left);
+            value1 = f(probe1);
+        } else {
+            // Keep [probe1, right]; the old probe2 becomes the new probe1
+            left = probe1;
+            probe1 = probe2;
+            value1 = value2;
+            probe2 = left + invPhi * (right - left);
+            value2 = f(probe2);
+        }
+        evaluations++; // Only one new evaluation per step
+    }
+    return (left + right) / 2;
+}
+
+// Fibonacci Search for the minimum of a unimodal function over the integers [left, right]
+template <typename Function>
+long long fibonacciSearchMinInt(Function f, long long left, long long right, int &evaluations) {
+    // Small ranges are checked directly
+    if (right - left < 3) {
+        return ternarySearchMinInt(f, left, right, evaluations);
+    }
+
+    // Find the smallest Fibonacci number F(k) such that F(k) - 1 >= number of candidates
+    long long fib[93] = {0, 1};
+    int k = 1;
+    while (fib[k] - 1 < right - left + 1) {
+        k++;
+        fib[k] = fib[k - 1] + fib[k - 2];
+    }
+
+    // Probes beyond `right` belong to the padding and evaluate to +infinity for free
+    auto evaluate = [&](long long x) {
+        if (x > right) return numeric_limits<double>::infinity();
+        evaluations++;
+        return (double) f(x);
+    };
+
+    // The open interval (low, low + F(k)) holds every candidate
+    long long low = left - 1;
+    long long probe1 = low + fib[k - 2];
+    long long probe2 = low + fib[k - 1];
+    double value1 = evaluate(probe1);
+    double value2 = evaluate(probe2);
+
+    while (k > 4) {
+        k--; // The interval shrinks from F(k) to F(k - 1)
+        if (value1 < value2) {
+            // Keep (low, probe2); the old probe1 becomes the new probe2
+            probe2 = probe1;
+            value2 = value1;
+            probe1 = low + fib[k - 2];
+            value1 = evaluate(probe1);
+        } else {
+            // Keep (probe1, low + F(k)); the old probe2 becomes the new probe1
+            low = probe1;
+            probe1 = probe2;
+            value1 = value2;
+            probe2 = low + fib[k - 1];
+            value2 = evaluate(probe2);
+        }
+    }
+
+    // The interval (low, low + 3) holds exactly the two probes
+    return value1 < value2 ? probe1 : probe2;
+}
+
+int main() {
+    /*
+        Capacity planning example: the cost of running `r` replicas is the queueing delay
+        (which drops as replicas are added) plus the price of the replicas themselves.
+        The cost is unimodal in `r`, with its minimum at r = 400.
+    */
+    auto replicaCost = [](long long replicas) {
+        return 4000000.0 / replicas + 25.0 * replicas;
+    };
+
+    long long minReplicas = 1;
+    long long maxReplicas = 100000;
+
+    cout << "Integer optimization over [" << minReplicas << ", " << maxReplicas << "]" << endl;
+
+    int ternaryEvaluations = 0;
+    long long ternaryBest = ternarySearchMinInt(replicaCost, minReplicas, maxReplicas, ternaryEvaluations);
+    cout << "Ternary Search:   best = " << ternaryBest << ", evaluations = " << ternaryEvaluations << endl;
+
+    int fibonacciEvaluations = 0;
+    long long fibonacciBest = fibonacciSearchMinInt(replicaCost, minReplicas, maxReplicas, fibonacciEvaluations);
+    cout << "Fibonacci Search: best = " << fibonacciBest << ", evaluations = " << fibonacciEvaluations << endl;
+
+    /*
+        Floating-point example: a smooth unimodal function with its minimum at x = 2.7.
+    */
+    auto smoothCost = [](double x) {
+        return (x - 2.7) * (x - 2.7) + 1.0;
+    };
+
+    double tolerance = 1e-9;
+
+    cout << "\nFloating-point optimization over [0, 10], tolerance " << tolerance << endl;
+
+    int ternaryRealEvaluations = 0;
+    double ternaryRealBest = ternarySearchMin(smoothCost, 0.0, 10.0, tolerance, ternaryRealEvaluations);
+    cout << "Ternary Search:        best = " << ternaryRealBest << ", evaluations = " << ternaryRealEvaluations << endl;
+
+    int goldenEvaluations = 0;
+    double goldenBest = goldenSectionSearchMin(smoothCost, 0.0, 10.0, tolerance, goldenEvaluations);
+    cout << "Golden-Section Search: best = " << goldenBest << ", evaluations = " << goldenEvaluations << endl;
+
+    return 0;
+}
@@ -0,0 +1,334 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <climits>
+using namespace std;
+
+/*
+    Dynamic Programming.cpp introduces memoization and tabulation with Fibonacci and factorial,
+    and lists the classic applications (knapsack, LCS, edit distance, matrix chain multiplication).
+    This program turns those applications into a reusable library.
+
+    Building blocks:
+
+    1. Grid DP (Tabulation):
+        Many string problems fill an (n + 1) x (m + 1) table where cell (i, j) only depends on
+        (i - 1, j - 1), (i - 1, j) and (i, j - 1). `solveGrid` fills such a table for any
+        recurrence in one of two modes:
+            - FullTable:   keeps every row, O(n * m) memory, needed when the whole table is read.
+            - RollingRows: keeps only the previous and the current row, O(m) memory.
+        Edit distance and LCS put the shorter string on the columns, so the rolling mode uses
+        O(min(n, m)) memory.
+
+    2. Hirschberg's Algorithm:
+        Rolling rows give the length of the LCS but not the subsequence itself, because the
+        table needed for backtracking is gone. Hirschberg splits the first string in half,
+        runs the rolling DP forwards on the top half and backwards on the bottom half, finds
+        the column where the optimal path crosses the middle row, and recurses on both halves.
+        The full LCS is rebuilt in O(n * m) time and O(n + m) memory.
+
+    3. Memo Cache (Memoization):
+        `MemoCache` stores results keyed by any hashable state (an int, a pair, a tuple...),
+        so top-down recursive solutions only need to describe the recurrence.
+
+    Problems:
+        - Edit Distance (Levenshtein): FullTable or RollingRows.
+        - Longest Common Subsequence: length in either mode, full subsequence via Hirschberg.
+        - 0/1 Knapsack: single-row tabulation iterating capacities downwards.
+        - Matrix Chain Multiplication: top-down with MemoCache keyed by (i, j).
+
+    Time Complexity:
+        - Edit distance, LCS and Hirschberg: O(n * m).
+        - 0/1 Knapsack: O(items * capacity).
+        - Matrix Chain Multiplication: O(k^3) for k matrices.
+
+    Space Complexity:
+        - FullTable: O(n * m). RollingRows and Hirschberg: O(min(n, m)) and O(n + m).
+        - 0/1 Knapsack: O(capacity). Matrix Chain: O(k^2) cache entries.
+*/
+
+/*
+    Grid DP (Tabulation)
+*/
+
+enum class DPMode {
+    FullTable,   // Keep all rows
+    RollingRows  // Keep only the previous and current rows
+};
+
+// View of the DP table handed to the recurrence; hides how rows are stored
+template <typename Cell>
+class GridView {
+private:
+    vector<Cell> cells;
+    int cols;
+    bool rolling;
+
+public:
+    GridView(int rows, int cols, DPMode mode)
+        : cols(cols), rolling(mode == DPMode::RollingRows) {
+        cells.resize((size_t) (rolling ? 2 : rows) * (cols + 1));
+    }
+
+    // Cell (i, j); in rolling mode only rows i and i - 1 of the current step are valid
+    Cell &at(int i, int j) {
+        size_t row = rolling ? (i & 1) : i;
+        return cells[row * (cols + 1) + j];
+    }
+};
+
+// Fills an (rows + 1) x (cols + 1) table with `recurrence(i, j, view)` and returns cell (rows, cols)
+template <typename Cell, typename Recurrence>
+Cell solveGrid(int rows, int cols, Recurrence recurrence, DPMode mode) {
+    GridView<Cell> view(rows + 1, cols, mode);
+    for (int i = 0; i <= rows; i++) {
+        for (int j = 0; j <= cols; j++) {
+            view.at(i, j) = recurrence(i, j, view);
+        }
+    }
+    return view.at(rows, cols);
+}
+
+/*
+    Edit Distance and Longest Common Subsequence
+*/
+
+// Minimum number of insertions, deletions and substitutions turning `a` into `b`
+int editDistance(const string &a, const string &b, DPMode mode = DPMode::RollingRows) {
+    // Shorter string on the columns so rolling rows use O(min(n, m)) memory
+    const string &rowString = a.size() >= b.size() ? a : b;
+    const string &colString = a.size() >= b.size() ? b : a;
+
+    return solveGrid<int>((int) rowString.size(), (int) colString.size(),
+        [&](int i, int j, GridView<int> &dp) {
+            if (i == 0) return j; // Insert j characters
+            if (j == 0) return i; // Delete i characters
+            int substitution = dp.at(i - 1, j - 1) + (rowString[i - 1] != colString[j - 1]);
+            int deletion = dp.at(i - 1, j) + 1;
+            int insertion = dp.at(i, j - 1) + 1;
+            return min(substitution, min(deletion, insertion));
+        }, mode);
+}
+
+// Length of the longest common subsequence of `a` and `b`
+int lcsLength(const string &a, const string &b, DPMode mode = DPMode::RollingRows) {
+    const string &rowString = a.size() >= b.size() ? a : b;
+    const string &colString = a.size() >= b.size() ? b : a;
+
+    return solveGrid<int>((int) rowString.size(), (int) colString.size(),
+        [&](int i, int j, GridView<int> &dp) {
+            if (i == 0 || j == 0) return 0;
+            if (rowString[i - 1] == colString[j - 1]) return dp.at(i - 1, j - 1) + 1;
+            return max(dp.at(i - 1, j), dp.at(i, j - 1));
+        }, mode);
+}
+
+/*
+    Hirschberg's Algorithm
+*/
+
+// Last row of the LCS table of a[aBegin, aEnd) and b[bBegin, bEnd), read forwards or backwards
+void lcsLastRow(const string &a, int aBegin, int aEnd, const string &b, int bBegin, int bEnd,
+                bool backwards, vector<int> &row) {
+    int cols = bEnd - bBegin;
+    row.assign(cols + 1, 0);
+    for (int i = 0; i < aEnd - aBegin; i++) {
+        char ca = backwards ? a[aEnd - 1 - i] : a[aBegin + i];
+        int diagonal = 0; // Value of row[j - 1] from the previous row
+        for (int j = 1; j <= cols; j++) {
+            char cb = backwards ? b[bEnd - j] : b[bBegin + j - 1];
+            int above = row[j];
+            row[j] = ca == cb ? diagonal + 1 : max(above, row[j - 1]);
+            diagonal = above;
+        }
+    }
+}
+
+// Appends the LCS of a[aBegin, aEnd) and b[bBegin, bEnd) to `result`
+void hirschberg(const string &a, int aBegin, int aEnd, const string &b, int bBegin, int bEnd,
+                string &result, vector<int> &forward, vector<int> &backward) {
+    if (aEnd - aBegin == 0 || bEnd - bBegin == 0) return;
+
+    // Base case: a single character is in the LCS if it appears anywhere in b
+    if (aEnd - aBegin == 1) {
+        for (int j = bBegin; j < bEnd; j++) {
+            if (b[j] == a[aBegin]) {
+                result += a[aBegin];
+                return;
+            }
+        }
+        return;
+    }
+
+    // Score of the top half forwards and of the bottom half backwards
+    int aMid = aBegin + (aEnd - aBegin) / 2;
+    lcsLastRow(a, aBegin, aMid, b, bBegin, bEnd, false, forward);
+    lcsLastRow(a, aMid, aEnd, b, bBegin, bEnd, true, backward);
+
+    // The optimal path crosses the middle row at the column with the best combined score
+    int cols = bEnd - bBegin;
+    int bestSplit = 0;
+    int bestScore = -1;
+    for (int k = 0; k <= cols; k++) {
+        int score = forward[k] + backward[cols - k];
+        if (score > bestScore) {
+            bestScore = score;
+            bestSplit = k;
+        }
+    }
+
+    // Solve both halves independently
+    hirschberg(a, aBegin, aMid, b, bBegin, bBegin + bestSplit, result, forward, backward);
+    hirschberg(a, aMid, aEnd, b, bBegin + bestSplit, bEnd, result, forward, backward);
+}
+
+// Longest common subsequence of `a` and `b` in linear space
+string lcsHirschberg(const string &a, const string &b) {
+    string result;
+    vector<int> forward, backward; // Reused by every level of the recursion
+    hirschberg(a, 0, (int) a.size(), b, 0, (int) b.size(), result, forward, backward);
+    return result;
+}
+
+/*
+    Memo Cache (Memoization)
+*/
+
+// Hash for pair states, e.g. (i, j) subproblems
+struct PairHash {
+    size_t operator()(const pair<int, int> &p) const {
+        return hash<long long>()(((long long) p.first << 32) ^ (unsigned int) p.second);
+    }
+};
+
+// Result cache keyed by any hashable state
+template <typename State, typename Value, typename Hash = hash<State>>
+class MemoCache {
+private:
+    unordered_map<State, Value, Hash> cache;
+
+public:
+    // Returns the cached value for `state`, computing and storing it on the first request
+    template <typename Compute>
+    Value getOrCompute(const State &state, Compute compute) {
+        auto it = cache.find(state);
+        if (it != cache.end()) return it->second;
+        Value value = compute(); // May recursively fill other entries
+        cache.emplace(state, value);
+        return value;
+    }
+
+    size_t size() const { return cache.size(); }
+    void clear() { cache.clear(); }
+};
+
+/*
+    0/1 Knapsack and Matrix Chain Multiplication
+*/
+
+// Maximum value that fits in `capacity`, each item used at most once
+int knapsack(const vector<int> &weights, const vector<int> &values, int capacity) {
+    vector<int> best(capacity + 1, 0); // Single rolling row over capacities
+    for (size_t item = 0; item < weights.size(); item++) {
+        // Downwards, so best[c - weight] still excludes the current item
+        for (int c = capacity; c >= weights[item]; c--) {
+            best[c] = max(best[c], best[c - weights[item]] + values[item]);
+        }
+    }
+    return best[capacity];
+}
+
+// Minimum scalar multiplications for the chain of matrices with `dims[i] x dims[i + 1]` shapes
+long long matrixChainCost(const vector<int> &dims) {
+    MemoCache<pair<int, int>, long long, PairHash> memo;
+
+    // Cost of multiplying matrices i..j
+    function<long long(int, int)> cost = [&](int i, int j) -> long long {
+        if (i == j) return 0;
+        return memo.getOrCompute({i, j}, [&]() {
+            long long best = LLONG_MAX;
+            for (int k = i; k < j; k++) {
+                long long split = cost(i, k) + cost(k + 1, j) + (long long) dims[i] * dims[k + 1] * dims[j + 1];
+                best = min(best, split);
+            }
+            return best;
+        });
+    };
+
+    return cost(0, (int) dims.size() - 2);
+}
+
+/*
+    Benchmark helpers
+*/
+
+// Random string over a small alphabet, so the strings share long subsequences
+string randomString(int length, mt19937 &rng) {
+    string s(length, 'a');
+    for (char &c : s) c = 'a' + rng() % 4;
+    return s;
+}
+
+// Whether `sub` is a subsequence of `s`
+bool isSubsequence(const string &sub, const string &s) {
+    size_t i = 0;
+    for (char c : s) {
+        if (i < sub.size() && sub[i] == c) i++;
+    }
+    return i == sub.size();
+}
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main() {
+
+    // Small examples
+    cout << "Edit distance (kitten, sitting): " << editDistance("kitten", "sitting") << endl;
+    cout << "LCS length (ABCBDAB, BDCABA):    " << lcsLength("ABCBDAB", "BDCABA") << endl;
+    cout << "LCS (ABCBDAB, BDCABA):           " << lcsHirschberg("ABCBDAB", "BDCABA") << endl;
+    cout << "Knapsack (capacity 50):          " << knapsack({10, 20, 30}, {60, 100, 120}, 50) << endl;
+    cout << "Matrix chain (10x30x5x60):       " << matrixChainCost({10, 30, 5, 60}) << endl;
+
+    mt19937 rng(42);
+
+    // Both modes must agree
+    string a = randomString(2000, rng);
+    string b = randomString(1500, rng);
+    cout << "\nConsistency check on 2000 x 1500 strings" << endl;
+    cout << "Edit distance full/rolling: " << editDistance(a, b, DPMode::FullTable) << " / "
+         << editDistance(a, b, DPMode::RollingRows) << endl;
+    string lcs = lcsHirschberg(a, b);
+    cout << "LCS length full/rolling/Hirschberg: " << lcsLength(a, b, DPMode::FullTable) << " / "
+         << lcsLength(a, b, DPMode::RollingRows) << " / " << lcs.size()
+         << (isSubsequence(lcs, a) && isSubsequence(lcs, b) ? " (valid subsequence)" : " (INVALID)") << endl;
+
+    // 10K x 10K benchmark; the full table would need 400 MB, so only the linear-space modes run
+    const int N = 10000;
+    string x = randomString(N, rng);
+    string y = randomString(N, rng);
+    int distance = 0, length = 0;
+    string subsequence;
+
+    cout << "\nBenchmark on " << N << " x " << N << " strings" << endl;
+    double editTime = millisecondsFor([&]() { distance = editDistance(x, y, DPMode::RollingRows); });
+    cout << "Edit distance (rolling rows): " << distance << " in " << editTime << " ms, "
+         << (2 * (N + 1) * sizeof(int)) / 1024 << " KB table" << endl;
+    double lcsTime = millisecondsFor([&]() { length = lcsLength(x, y, DPMode::RollingRows); });
+    cout << "LCS length (rolling rows):    " << length << " in " << lcsTime << " ms" << endl;
+    double hirschbergTime = millisecondsFor([&]() { subsequence = lcsHirschberg(x, y); });
+    cout << "LCS string (Hirschberg):      " << subsequence.size() << " chars in " << hirschbergTime << " ms" << endl;
+
+    return 0;
+}
@@ -0,0 +1,400 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+using namespace std;
+
+/*
+    The classic edit distance and LCS tables (see Dynamic Programming Library.cpp) compute one
+    cell per step. For deduplication over many 100-1000 character records, the same recurrences
+    can be evaluated many cells at a time:
+
+    1. Myers' Bit-Vector Edit Distance:
+        Adjacent cells of a DP column differ by only -1, 0 or +1. Myers encodes a whole column
+        of these differences in two bit vectors (Pv: +1, Mv: -1) and advances a column with a
+        handful of AND/OR/XOR/ADD operations on 64-bit words, i.e. 64 cells per operation.
+        Patterns longer than 64 characters are split into blocks whose carries flow from one
+        block to the next (Hyyrö's blocked variant).
+
+    2. Bit-Parallel LCS (Allison-Dix / Hyyrö):
+        The LCS column is encoded in a single bit vector V whose zero bits mark where the LCS
+        grows. One column step is  V = (V + (V & M)) | (V & ~M), where M is the match mask of
+        the current character.
+
+    3. Anti-Diagonal Kernel:
+        All cells on an anti-diagonal (i + j = constant) are independent of each other. Storing
+        the table by anti-diagonals, with the second string reversed, makes every inner loop a
+        branch-free pass over contiguous arrays. The loop is written with GCC/Clang vector
+        types, so it uses SIMD at the default -O2 without relying on autovectorization. Cells
+        are 16-bit whenever the distances fit: eight cells per SSE2 step (sixteen with AVX2),
+        each taken with the single-instruction 16-bit min.
+
+    4. Banded Edit Distance (Ukkonen):
+        If only distances up to k matter, cells with |i - j| > k can never lead to a result
+        within k. The anti-diagonal kernel computes only the part of each diagonal inside that
+        band, clamps cells at k + 1 so they stay 16-bit even on long strings, and stops as soon
+        as two consecutive diagonals exceed k (every path crosses one of them).
+
+    Time Complexity (pattern of length m, text of length n, word size w = 64):
+        - Classic DP:         O(n * m)
+        - Myers / Bit LCS:    O(n * ceil(m / w))
+        - Anti-diagonal:      O(n * m) operations, divided by the SIMD width in practice
+        - Banded:             O((n + m) * k) operations, divided by the SIMD width; stops
+                              earlier when the threshold is exceeded
+
+    Space Complexity:
+        - Myers / Bit LCS: O(ceil(m / w) * alphabet) for the match masks.
+        - Anti-diagonal, Banded and Classic: O(n + m).
+*/
+
+/*
+    Classic O(n * m) Edit Distance and LCS (reference implementations)
+*/
+
+int classicEditDistance(const string &a, const string &b) {
+    int n = a.size(), m = b.size();
+    vector<int> prev(m + 1), cur(m + 1);
+    for (int j = 0; j <= m; j++) prev[j] = j;
+    for (int i = 1; i <= n; i++) {
+        cur[0] = i;
+        for (int j = 1; j <= m; j++) {
+            cur[j] = min(prev[j - 1] + (a[i - 1] != b[j - 1]), min(prev[j], cur[j - 1]) + 1);
+        }
+        swap(prev, cur);
+    }
+    return prev[m];
+}
+
+int classicLcs(const string &a, const string &b) {
+    int n = a.size(), m = b.size();
+    vector<int> prev(m + 1, 0), cur(m + 1, 0);
+    for (int i = 1; i <= n; i++) {
+        for (int j = 1; j <= m; j++) {
+            cur[j] = a[i - 1] == b[j - 1] ? prev[j - 1] + 1 : max(prev[j], cur[j - 1]);
+        }
+        swap(prev, cur);
+    }
+    return prev[m];
+}
+
+/*
+    Match masks: bit i of mask[c] is set when pattern[i] == c
+*/
+
+const int ALPHABET = 256;
+
+// Match masks for every 64-character block of the pattern
+vector<uint64_t> buildMatchMasks(const string &pattern, int blocks) {
+    vector<uint64_t> masks((size_t) blocks * ALPHABET, 0);
+    for (size_t i = 0; i < pattern.size(); i++) {
+        masks[(i / 64) * ALPHABET + (unsigned char) pattern[i]] |= 1ULL << (i % 64);
+    }
+    return masks;
+}
+
+/*
+    Myers' Bit-Vector Edit Distance
+*/
+
+// Advances one 64-row block by one column; returns the horizontal delta leaving the block
+inline int advanceBlock(uint64_t &pv, uint64_t &mv, uint64_t eq, int horizontalIn, uint64_t highBit) {
+    uint64_t inIsNegative = horizontalIn < 0 ? 1 : 0;
+    uint64_t xv = eq | mv;
+    eq |= inIsNegative;
+    uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph = mv | ~(xh | pv);
+    uint64_t mh = pv & xh;
+
+    int horizontalOut = 0;
+    if (ph & highBit) horizontalOut = 1;
+    if (mh & highBit) horizontalOut = -1;
+
+    ph = (ph << 1) | (horizontalIn > 0 ? 1 : 0);
+    mh = (mh << 1) | inIsNegative;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+    return horizontalOut;
+}
+
+// Edit distance; returns maxDistance + 1 as soon as the result is known to exceed maxDistance
+int myersEditDistance(const string &pattern, const string &text, int maxDistance = INT_MAX) {
+    if (maxDistance < 0) throw invalid_argument("maxDistance must not be negative");
+    int m = pattern.size(), n = text.size();
+    maxDistance = min(maxDistance, max(m, n)); // No distance exceeds the longer length
+    if (m == 0) return min(n, maxDistance + 1);
+
+    int blocks = (m + 63) / 64;
+    vector<uint64_t> masks = buildMatchMasks(pattern, blocks);
+    vector<uint64_t> pv(blocks, ~0ULL); // First column is 0, 1, 2, ..., m: every delta is +1
+    vector<uint64_t> mv(blocks, 0);
+    uint64_t lastHighBit = 1ULL << ((m - 1) % 64); // Row m sits inside the last block
+
+    int score = m; // Value of the bottom cell D[m][j]
+    for (int j = 0; j < n; j++) {
+        const uint64_t *column = &masks[(unsigned char) text[j]];
+        int carry = 1; // Top row is 0, 1, 2, ..., n: horizontal delta +1
+        for (int b = 0; b < blocks; b++) {
+            uint64_t highBit = b == blocks - 1 ? lastHighBit : 1ULL << 63;
+            carry = advanceBlock(pv[b], mv[b], column[(size_t) b * ALPHABET], carry, highBit);
+        }
+        score += carry;
+
+        // D[m][n] >= D[m][j] - (remaining columns), so stop once it can no longer reach the bound
+        if (score - (n - 1 - j) > maxDistance) return maxDistance + 1;
+    }
+    return min(score, maxDistance + 1);
+}
+
+/*
+    Bit-Parallel LCS
+*/
+
+int bitParallelLcs(const string &pattern, const string &text) {
+    int m = pattern.size();
+    if (m == 0) return 0;
+
+    int blocks = (m + 63) / 64;
+    vector<uint64_t> masks = buildMatchMasks(pattern, blocks);
+    vector<uint64_t> v(blocks, ~0ULL);
+
+    for (char c : text) {
+        const uint64_t *column = &masks[(unsigned char) c];
+        uint64_t carry = 0;
+        for (int b = 0; b < blocks; b++) {
+            uint64_t match = column[(size_t) b * ALPHABET];
+            uint64_t u = v[b] & match;
+            unsigned __int128 sum = (unsigned __int128) v[b] + u + carry; // Carry flows into the next block
+            carry = (uint64_t) (sum >> 64);
+            v[b] = (uint64_t) sum | (v[b] & ~match);
+        }
+    }
+
+    // Every zero bit inside the pattern length is one LCS character
+    int length = 0;
+    for (int b = 0; b < blocks; b++) {
+        int bits = b == blocks - 1 ? m - 64 * b : 64;
+        uint64_t valid = bits == 64 ? ~0ULL : (1ULL << bits) - 1;
+        length += __builtin_popcountll(~v[b] & valid);
+    }
+    return length;
+}
+
+/*
+    Anti-Diagonal (SIMD) Edit Distance, full or banded
+*/
+
+// Bytes per SIMD register: 32 with AVX2 (-march=native on recent x86), 16 otherwise
+#ifdef __AVX2__
+const int VECTOR_BYTES = 32;
+#else
+const int VECTOR_BYTES = 16;
+#endif
+
+// Edit distance over the cells with |i - j| <= maxDistance. When Banded, every cell is clamped
+// to maxDistance + 1, so any result above the threshold comes out as maxDistance + 1, and the
+// loop stops once the threshold is exceeded; otherwise maxDistance is max(n, m), the band is the
+// whole table and neither is needed. Cell is short whenever maxDistance + 2 fits in 16 bits:
+// twice the lanes per register, and SSE2 has a 16-bit min (pminsw) but no 32-bit one.
+template <typename Cell, bool Banded>
+int antiDiagonalKernel(const string &a, const string &b, int maxDistance) {
+    // GCC and Clang turn the operators on this type into SIMD instructions (SSE2 on any x86-64
+    // at -O2, NEON on ARM), with no intrinsics needed
+    typedef Cell CellVector __attribute__((vector_size(VECTOR_BYTES)));
+    const int WIDTH = VECTOR_BYTES / sizeof(Cell);
+    auto load = [](const Cell *p) {
+        CellVector v;
+        memcpy(&v, p, sizeof v);
+        return v;
+    };
+
+    int n = a.size(), m = b.size();
+    const Cell OUT = maxDistance + 1; // Any value above the threshold
+    if (abs(n - m) > maxDistance) return OUT;
+    if (n == 0 || m == 0) return n + m;
+    const CellVector OUT_VECTOR = CellVector{} + OUT;
+
+    // Lane numbers 0, 1, ..., WIDTH - 1, to mask the lanes past the end of a diagonal
+    CellVector laneNumbers;
+    for (int l = 0; l < WIDTH; l++) laneNumbers[l] = l;
+
+    // Characters widened to cells so they load like the DP cells; b is reversed so that b[j - 1]
+    // is contiguous along a diagonal. Every array has WIDTH cells of padding, so the last vector
+    // of a diagonal can be loaded and stored whole.
+    vector<Cell> wideA(n + WIDTH), reversedB(m + WIDTH);
+    copy(a.begin(), a.end(), wideA.begin());
+    copy(b.rbegin(), b.rend(), reversedB.begin());
+    const Cell *pa = wideA.data();
+    const Cell *pb = reversedB.data();
+
+    // Diagonals k - 2, k - 1 and k, each indexed by the row i
+    vector<Cell> twoBack(n + 1 + WIDTH, OUT), oneBack(n + 1 + WIDTH, OUT), current(n + 1 + WIDTH, OUT);
+    oneBack[0] = 0; // Diagonal 0 holds only cell (0, 0)
+    int previousMinimum = 0;
+
+    for (int k = 1; k <= n + m; k++) {
+        Cell *d2 = current.data();
+        const Cell *d1 = oneBack.data();
+        const Cell *d0 = twoBack.data();
+
+        // Inner cells (i, k - i) of the table, and the part of them inside the band, where
+        // |i - (k - i)| <= maxDistance
+        int start = max(1, k - m);
+        int end = min(n, k - 1);
+        int low = max(start, (k - maxDistance + 1) / 2);
+        int high = min(end, (k + maxDistance) / 2);
+
+        // Cell (i, k - i) compares a[i - 1] with b[k - i - 1] == reversedB[m - k + i]
+        const Cell *bDiagonal = pb + (m - k + low); // In range: m - k + low >= 0
+        auto cellsAt = [&](int i) { // Cells i, ..., i + WIDTH - 1 of diagonal k
+            CellVector left = load(d1 + i - 1), up = load(d1 + i);
+            CellVector gap = (left < up ? left : up) + 1;
+            CellVector differs = load(pa + i - 1) != load(bDiagonal + (i - low)); // -1 or 0
+            CellVector substitution = load(d0 + i - 1) - differs;
+            CellVector cell = gap < substitution ? gap : substitution;
+            return Banded ? (cell < OUT_VECTOR ? cell : OUT_VECTOR) : cell;
+        };
+
+        // Independent cells, WIDTH at a time
+        CellVector vectorMinimum = OUT_VECTOR;
+        int i = low;
+        for (; i + WIDTH - 1 <= high; i += WIDTH) {
+            CellVector cell = cellsAt(i);
+            if (Banded) vectorMinimum = cell < vectorMinimum ? cell : vectorMinimum;
+            memcpy(d2 + i, &cell, sizeof cell);
+        }
+        if (i <= high) { // Last, partial vector: the lanes past `high` become OUT
+            CellVector cell = cellsAt(i);
+            cell = laneNumbers > (Cell) (high - i) ? OUT_VECTOR : cell;
+            if (Banded) vectorMinimum = cell < vectorMinimum ? cell : vectorMinimum;
+            memcpy(d2 + i, &cell, sizeof cell);
+        }
+
+        // Table edges, written after the vectors that may have run over cell (k, 0)
+        int minimum = OUT;
+        if (k <= m) minimum = d2[0] = min(k, (int) OUT); // Cell (0, k)
+        if (k <= n) minimum = d2[k] = min(k, (int) OUT); // Cell (k, 0)
+
+        // Band edges, read by the next diagonal; older diagonals' cells may still sit there
+        if (low - 1 >= start && low - 1 <= end) d2[low - 1] = OUT;
+        if (high + 1 >= start && high + 1 <= end) d2[high + 1] = OUT;
+
+        // A path moves one or two diagonals per step, so it crosses diagonal k - 1 or k
+        if (Banded) {
+            for (int l = 0; l < WIDTH; l++) minimum = min(minimum, (int) vectorMinimum[l]);
+            if (min(minimum, previousMinimum) > maxDistance) return OUT;
+            previousMinimum = minimum;
+        }
+
+        // Rotate the diagonals without copying
+        swap(twoBack, oneBack);
+        swap(oneBack, current);
+    }
+    return oneBack[n]; // Cell (n, m) lies on the last diagonal
+}
+
+int antiDiagonalEditDistance(const string &a, const string &b) {
+    int longest = max(a.size(), b.size()); // No distance exceeds it
+    if (longest + 2 <= SHRT_MAX) return antiDiagonalKernel<short, false>(a, b, longest);
+    return antiDiagonalKernel<int, false>(a, b, longest);
+}
+
+/*
+    Banded Edit Distance with early termination
+*/
+
+// Edit distance if it is at most maxDistance, otherwise maxDistance + 1
+int bandedEditDistance(const string &a, const string &b, int maxDistance) {
+    if (maxDistance < 0) throw invalid_argument("maxDistance must not be negative");
+    // No distance exceeds the longer length, so a larger threshold changes nothing
+    maxDistance = min(maxDistance, (int) max(a.size(), b.size()));
+    if (maxDistance + 2 <= SHRT_MAX) return antiDiagonalKernel<short, true>(a, b, maxDistance);
+    return antiDiagonalKernel<int, true>(a, b, maxDistance);
+}
+
+/*
+    Throughput benchmark
+*/
+
+// Random record of the given length
+string randomRecord(int length, mt19937 &rng) {
+    string s(length, ' ');
+    for (char &c : s) c = 'a' + rng() % 26;
+    return s;
+}
+
+// Copy of `s` with roughly `rate` of its characters substituted, inserted or deleted
+string mutate(const string &s, double rate, mt19937 &rng) {
+    uniform_real_distribution<double> chance(0.0, 1.0);
+    string result;
+    for (char c : s) {
+        double r = chance(rng);
+        if (r < rate / 3) continue;                                   // Deletion
+        if (r < 2 * rate / 3) result += (char) ('a' + rng() % 26);    // Substitution
+        else result += c;
+        if (r > 1 - rate / 3) result += (char) ('a' + rng() % 26);    // Insertion
+    }
+    return result;
+}
+
+// Pairs per second for `distance` over all pairs; also returns the sum of results as a checksum
+template <typename Distance>
+double pairsPerSecond(const vector<pair<string, string>> &pairs, Distance distance, long long &checksum) {
+    checksum = 0;
+    auto start = chrono::steady_clock::now();
+    for (const auto &p : pairs) {
+        checksum += distance(p.first, p.second);
+    }
+    auto end = chrono::steady_clock::now();
+    return pairs.size() / chrono::duration<double>(end - start).count();
+}
+
+int main() {
+
+    // Small example
+    cout << "kitten -> sitting" << endl;
+    cout << "  Classic edit distance:       " << classicEditDistance("kitten", "sitting") << endl;
+    cout << "  Myers edit distance:         " << myersEditDistance("kitten", "sitting") << endl;
+    cout << "  Anti-diagonal edit distance: " << antiDiagonalEditDistance("kitten", "sitting") << endl;
+    cout << "  Banded (k = 2):              " << bandedEditDistance("kitten", "sitting", 2) << " (exceeds 2)" << endl;
+    cout << "  Classic / bit-parallel LCS:  " << classicLcs("kitten", "sitting") << " / " << bitParallelLcs("kitten", "sitting") << endl;
+
+    // Record pairs of 100-1000 characters with ~10% edits, like near-duplicate records
+    mt19937 rng(7);
+    vector<pair<string, string>> pairs;
+    for (int i = 0; i < 2000; i++) {
+        string record = randomRecord(100 + rng() % 901, rng);
+        pairs.push_back({record, mutate(record, 0.10, rng)});
+    }
+
+    const int THRESHOLD = 100; // Banded modes only care about distances up to this value
+    long long classicSum, myersSum, diagonalSum, bandedSum, myersBandSum, classicLcsSum, bitLcsSum;
+
+    cout << "\nThroughput on " << pairs.size() << " record pairs (100-1000 characters, ~10% edits)" << endl;
+    double classic = pairsPerSecond(pairs, classicEditDistance, classicSum);
+    double myers = pairsPerSecond(pairs, [](const string &a, const string &b) { return myersEditDistance(a, b); }, myersSum);
+    double diagonal = pairsPerSecond(pairs, antiDiagonalEditDistance, diagonalSum);
+    double banded = pairsPerSecond(pairs, [&](const string &a, const string &b) { return bandedEditDistance(a, b, THRESHOLD); }, bandedSum);
+    double myersBand = pairsPerSecond(pairs, [&](const string &a, const string &b) { return myersEditDistance(a, b, THRESHOLD); }, myersBandSum);
+    double lcsClassic = pairsPerSecond(pairs, classicLcs, classicLcsSum);
+    double lcsBits = pairsPerSecond(pairs, bitParallelLcs, bitLcsSum);
+
+    cout << "  Classic edit distance:       " << (long long) classic << " pairs/s" << endl;
+    cout << "  Myers bit-vector:            " << (long long) myers << " pairs/s (x" << myers / classic << ")"
+         << (myersSum == classicSum ? "" : " MISMATCH") << endl;
+    cout << "  Anti-diagonal kernel:        " << (long long) diagonal << " pairs/s (x" << diagonal / classic << ")"
+         << (diagonalSum == classicSum ? "" : " MISMATCH") << endl;
+    cout << "  Banded (k = " << THRESHOLD << "):            " << (long long) banded << " pairs/s (x" << banded / classic << ")"
+         << (bandedSum == myersBandSum ? "" : " MISMATCH") << endl;
+    cout << "  Myers with cutoff (k = " << THRESHOLD << "): " << (long long) myersBand << " pairs/s (x" << myersBand / classic << ")" << endl;
+    cout << "  Classic LCS:                 " << (long long) lcsClassic << " pairs/s" << endl;
+    cout << "  Bit-parallel LCS:            " << (long long) lcsBits << " pairs/s (x" << lcsBits / lcsClassic << ")"
+         << (bitLcsSum == classicLcsSum ? "" : " MISMATCH") << endl;
+
+    return 0;
+}
@@ -0,0 +1,423 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/*
+    Array.cpp uses a fixed-size stack array (`int arr[]`) and Space Complexity.cpp allocates a
+    raw `new int[n]` that cannot grow. A dynamic array keeps the O(1) indexed access of an
+    array but grows as elements are appended, like `std::vector`.
+
+    How it grows:
+        - When the array is full, a larger block is allocated, the elements are moved over and
+          the old block is released. Growing by a constant factor (e.g. x2 or x1.5) makes the
+          total copying cost O(n) over n appends, so push_back is amortized O(1).
+        - A larger growth factor means fewer reallocations but more unused capacity; 1.5 lets
+          the allocator reuse freed blocks, 2 minimizes copying. The factor is configurable.
+
+    Features of `DynamicArray<T, InlineCapacity>`:
+        - Small-buffer optimization: the first `InlineCapacity` elements are stored inside
+          the object itself, so short arrays never touch the heap.
+        - 64-byte aligned heap storage: the data starts on a cache-line boundary, which SIMD
+          loads and stores prefer.
+        - Trivially relocatable moves: for trivially copyable types (int, double, plain
+          structs), growing uses `realloc`, which can often extend the block in place, or a
+          single `memcpy`, instead of constructing and destroying elements one by one.
+        - reserve(n) and shrink_to_fit(), which returns to the inline buffer when it fits.
+
+    Time Complexity:
+        - Access: O(1).
+        - push_back / emplace_back: amortized O(1), O(n) when a reallocation happens.
+        - pop_back: O(1).
+        - reserve / shrink_to_fit: O(n).
+
+    Space Complexity:
+        - O(capacity), at most growthFactor times the number of elements, plus the inline buffer.
+
+    Pros:
+        - Contiguous memory: cache friendly and SIMD friendly.
+        - No heap allocation for small arrays.
+
+    Cons:
+        - A reallocation invalidates pointers and references to the elements.
+        - Inserting or erasing in the middle is O(n), as with any array.
+*/
+
+template <typename T, size_t InlineCapacity = 16>
+class DynamicArray {
+private:
+    static const size_t ALIGNMENT = 64; // Cache line size
+    static constexpr bool RELOCATABLE = is_trivially_copyable<T>::value;
+
+    T *elements;        // Points at the inline buffer or at the heap block
+    size_t count;
+    size_t capacityValue;
+    double growthFactor;
+    alignas(ALIGNMENT) unsigned char inlineBuffer[InlineCapacity * sizeof(T) > 0 ? InlineCapacity * sizeof(T) : 1];
+
+    T *inlineData() { return reinterpret_cast<T *>(inlineBuffer); }
+    bool usesInline() const { return elements == reinterpret_cast<const T *>(inlineBuffer); }
+
+    // Rounded up to a multiple of the alignment, as aligned_alloc requires
+    static size_t blockBytes(size_t n) {
+        size_t bytes = n * sizeof(T);
+        return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    static T *allocateAligned(size_t n) {
+        void *block = aligned_alloc(ALIGNMENT, blockBytes(n));
+        if (!block) throw bad_alloc();
+        return static_cast<T *>(block);
+    }
+
+    // Moves every element into storage for `newCapacity` elements (which may be the inline buffer)
+    void relocate(size_t newCapacity) {
+        bool toInline = newCapacity <= InlineCapacity;
+
+        if constexpr (RELOCATABLE) {
+            if (!usesInline() && !toInline) {
+                // realloc may grow the block in place; it only guarantees malloc alignment, so
+                // an unaligned result is copied once more into an aligned block
+                void *grown = realloc(elements, blockBytes(newCapacity));
+                if (!grown) throw bad_alloc();
+                if (reinterpret_cast<uintptr_t>(grown) % ALIGNMENT != 0) {
+                    T *aligned = allocateAligned(newCapacity);
+                    memcpy(static_cast<void *>(aligned), grown, count * sizeof(T));
+                    free(grown);
+                    grown = aligned;
+                }
+                elements = static_cast<T *>(grown);
+                capacityValue = newCapacity;
+                return;
+            }
+        }
+
+        T *target = toInline ? inlineData() : allocateAligned(newCapacity);
+        if constexpr (RELOCATABLE) {
+            if (count > 0) memcpy(static_cast<void *>(target), static_cast<const void *>(elements), count * sizeof(T));
+        } else {
+            // The old elements stay intact until every new one is built, so a throwing copy
+            // leaves the array as it was
+            size_t built = 0;
+            try {
+                for (; built < count; built++) new (&target[built]) T(move_if_noexcept(elements[built]));
+            } catch (...) {
+                for (size_t i = 0; i < built; i++) target[i].~T();
+                if (!toInline) free(target);
+                throw;
+            }
+            for (size_t i = 0; i < count; i++) elements[i].~T();
+        }
+        if (!usesInline()) free(elements);
+
+        elements = target;
+        capacityValue = toInline ? InlineCapacity : newCapacity;
+    }
+
+    // Moves the inline elements of `other` into this empty array; if a move throws, the ones
+    // already moved in are destroyed, since the destructor does not run for a throwing constructor
+    void moveInlineElements(DynamicArray &other) {
+        try {
+            for (; count < other.count; count++) new (&elements[count]) T(std::move(other.elements[count]));
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    void grow() {
+        size_t grown = (size_t) (capacityValue * growthFactor);
+        relocate(max(grown, capacityValue + 1));
+    }
+
+public:
+    explicit DynamicArray(double growthFactor = 2.0)
+        : elements(inlineData()), count(0), capacityValue(InlineCapacity), growthFactor(growthFactor) {
+        if (growthFactor <= 1.0) {
+            throw invalid_argument("Growth factor must be greater than 1.");
+        }
+    }
+
+    DynamicArray(const DynamicArray &other) : DynamicArray(other.growthFactor) {
+        reserve(other.count);
+        for (size_t i = 0; i < other.count; i++) push_back(other.elements[i]);
+    }
+
+    DynamicArray(DynamicArray &&other) noexcept(is_nothrow_move_constructible<T>::value)
+        : elements(inlineData()), count(0), capacityValue(InlineCapacity), growthFactor(other.growthFactor) {
+        if (other.usesInline()) {
+            // Inline elements live inside `other`, so they have to be moved one by one
+            moveInlineElements(other);
+            other.clear();
+        } else {
+            // Heap storage changes owner without touching the elements
+            elements = other.elements;
+            count = other.count;
+            capacityValue = other.capacityValue;
+            other.elements = other.inlineData();
+            other.count = 0;
+            other.capacityValue = InlineCapacity;
+        }
+    }
+
+    // Copy-and-swap: `other` is already a copy (or took over a moved-from source)
+    DynamicArray &operator=(DynamicArray other) {
+        swap(other);
+        return *this;
+    }
+
+    // Exchanges the contents. Heap blocks change owner; inline elements have to be moved
+    void swap(DynamicArray &other) {
+        if (this == &other) return;
+        if (!usesInline() && !other.usesInline()) {
+            std::swap(elements, other.elements);
+            std::swap(count, other.count);
+            std::swap(capacityValue, other.capacityValue);
+        } else if (usesInline() && other.usesInline()) {
+            DynamicArray &longer = count >= other.count ? *this : other;
+            DynamicArray &shorter = count >= other.count ? other : *this;
+            size_t common = shorter.count;
+            for (size_t i = 0; i < common; i++) std::swap(elements[i], other.elements[i]);
+            for (size_t i = common; i < longer.count; i++) {
+                new (&shorter.elements[i]) T(std::move(longer.elements[i]));
+                shorter.count++;
+            }
+            for (size_t i = common; i < longer.count; i++) longer.elements[i].~T();
+            longer.count = common;
+        } else {
+            // The inline elements move into the unused inline buffer of the heap side, which
+            // then hands its heap block over
+            DynamicArray &small = usesInline() ? *this : other;
+            DynamicArray &large = usesInline() ? other : *this;
+            T *buffer = large.inlineData();
+            size_t built = 0;
+            try {
+                for (; built < small.count; built++) new (&buffer[built]) T(std::move(small.elements[built]));
+            } catch (...) {
+                for (size_t i = 0; i < built; i++) buffer[i].~T();
+                throw;
+            }
+            for (size_t i = 0; i < small.count; i++) small.elements[i].~T();
+            small.elements = large.elements;
+            large.elements = buffer;
+            std::swap(small.capacityValue, large.capacityValue);
+            std::swap(small.count, large.count);
+        }
+        std::swap(growthFactor, other.growthFactor);
+    }
+
+    ~DynamicArray() {
+        clear();
+        if (!usesInline()) free(elements);
+    }
+
+    // Element access
+    T &operator[](size_t index) { return elements[index]; }
+    const T &operator[](size_t index) const { return elements[index]; }
+
+    T &at(size_t index) {
+        if (index >= count) throw out_of_range("DynamicArray index out of range.");
+        return elements[index];
+    }
+
+    T *data() { return elements; }
+    T *begin() { return elements; }
+    T *end() { return elements + count; }
+    const T *begin() const { return elements; }
+    const T *end() const { return elements + count; }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return capacityValue; }
+    bool isEmpty() const { return count == 0; }
+    bool isInline() const { return usesInline(); }
+
+    // Adds an element at the end, growing the storage when full
+    void push_back(const T &value) {
+        if (count == capacityValue) {
+            T copy = value; // `value` may refer to an element that is about to move
+            grow();
+            new (&elements[count++]) T(std::move(copy));
+            return;
+        }
+        new (&elements[count++]) T(value);
+    }
+
+    void push_back(T &&value) {
+        if (count == capacityValue) {
+            T moved = std::move(value);
+            grow();
+            new (&elements[count++]) T(std::move(moved));
+            return;
+        }
+        new (&elements[count++]) T(std::move(value));
+    }
+
+    // Constructs an element in place at the end
+    template <typename... Args>
+    T &emplace_back(Args &&... args) {
+        if (count == capacityValue) {
+            T built(std::forward<Args>(args)...); // `args` may refer to an element that is about to move
+            grow();
+            return *new (&elements[count++]) T(std::move(built));
+        }
+        T *slot = new (&elements[count]) T(std::forward<Args>(args)...);
+        count++;
+        return *slot;
+    }
+
+    // Removes the last element
+    void pop_back() {
+        if (count == 0) throw out_of_range("pop_back on an empty DynamicArray.");
+        elements[--count].~T();
+    }
+
+    // Destroys every element, keeping the capacity
+    void clear() {
+        for (size_t i = 0; i < count; i++) elements[i].~T();
+        count = 0;
+    }
+
+    // Ensures room for at least `n` elements without further reallocation
+    void reserve(size_t n) {
+        if (n > capacityValue) relocate(n);
+    }
+
+    // Releases unused capacity; moves back into the inline buffer when the elements fit
+    void shrink_to_fit() {
+        if (usesInline() || count == capacityValue) return;
+        relocate(max(count, (size_t) 1));
+    }
+};
+
+/*
+    Benchmark helpers
+*/
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+volatile long long arraySink; // Keeps benchmarked results alive
+
+int main() {
+
+    // Basic usage, matching Array.cpp
+    DynamicArray<int> arr;
+    for (int value : {10, 20, 30, 40, 50}) arr.push_back(value);
+
+    cout << "Array elements: ";
+    for (int value : arr) cout << value << " ";
+    cout << endl;
+    cout << "Element at index 2: " << arr[2] << endl;
+    arr[3] = 100;
+    cout << "Size " << arr.size() << ", capacity " << arr.capacity() << ", inline: " << (arr.isInline() ? "yes" : "no") << endl;
+
+    // Growing past the inline buffer moves the data to aligned heap storage
+    for (int i = 0; i < 100; i++) arr.push_back(i);
+    cout << "After 100 more pushes: size " << arr.size() << ", capacity " << arr.capacity()
+         << ", inline: " << (arr.isInline() ? "yes" : "no")
+         << ", 64-byte aligned: " << (reinterpret_cast<uintptr_t>(arr.data()) % 64 == 0 ? "yes" : "no") << endl;
+
+    while (arr.size() > 5) arr.pop_back();
+    arr.shrink_to_fit();
+    cout << "After pop_back and shrink_to_fit: size " << arr.size() << ", capacity " << arr.capacity()
+         << ", inline: " << (arr.isInline() ? "yes" : "no") << endl;
+
+    // Non-trivial element types are moved element by element
+    DynamicArray<string, 2> words;
+    words.emplace_back("dynamic");
+    words.emplace_back("arrays");
+    words.emplace_back("grow");
+    DynamicArray<string, 2> movedWords = std::move(words);
+    cout << "Strings: ";
+    for (const string &w : movedWords) cout << w << " ";
+    cout << endl;
+
+    // Error reporting
+    try {
+        arr.at(42);
+    } catch (const out_of_range &e) {
+        cout << "at(42): " << e.what() << endl;
+    }
+
+    // push_back throughput against std::vector
+    const int N = 20000000;
+    cout << "\nBenchmark: " << N << " push_back calls of int" << endl;
+
+    // Warm-up so the first measured run does not pay for fresh pages from the OS
+    {
+        vector<int> warmUp(N);
+        arraySink = warmUp[N / 2];
+    }
+
+    double vectorTime = millisecondsFor([&]() {
+        vector<int> v;
+        for (int i = 0; i < N; i++) v.push_back(i);
+        arraySink = v.back();
+    });
+    double dynamicTime = millisecondsFor([&]() {
+        DynamicArray<int> d;
+        for (int i = 0; i < N; i++) d.push_back(i);
+        arraySink = d[N - 1];
+    });
+    double dynamicSlowGrowthTime = millisecondsFor([&]() {
+        DynamicArray<int> d(1.5);
+        for (int i = 0; i < N; i++) d.push_back(i);
+        arraySink = d[N - 1];
+    });
+    cout << "std::vector<int>:                " << vectorTime << " ms" << endl;
+    cout << "DynamicArray<int> (x2 growth):   " << dynamicTime << " ms" << endl;
+    cout << "DynamicArray<int> (x1.5 growth): " << dynamicSlowGrowthTime << " ms" << endl;
+
+    // Many short arrays: the inline buffer avoids one heap allocation per array
+    const int SHORT_ARRAYS = 2000000;
+    cout << "\nBenchmark: " << SHORT_ARRAYS << " arrays of 8 ints" << endl;
+    double shortVector = millisecondsFor([&]() {
+        long long total = 0;
+        for (int a = 0; a < SHORT_ARRAYS; a++) {
+            vector<int> v;
+            for (int i = 0; i < 8; i++) v.push_back(i + a);
+            total += v[7];
+        }
+        arraySink = total;
+    });
+    double shortDynamic = millisecondsFor([&]() {
+        long long total = 0;
+        for (int a = 0; a < SHORT_ARRAYS; a++) {
+            DynamicArray<int> d;
+            for (int i = 0; i < 8; i++) d.push_back(i + a);
+            total += d[7];
+        }
+        arraySink = total;
+    });
+    cout << "std::vector<int>:  " << shortVector << " ms" << endl;
+    cout << "DynamicArray<int>: " << shortDynamic << " ms" << endl;
+
+    // Memory overhead: unused capacity after N pushes
+    cout << "\nMemory overhead after " << N << " pushes (bytes beyond the " << (long long) N * 4 << " bytes of data)" << endl;
+    vector<int> v;
+    DynamicArray<int> d2, d15(1.5);
+    for (int i = 0; i < N; i++) {
+        v.push_back(i);
+        d2.push_back(i);
+        d15.push_back(i);
+    }
+    cout << "std::vector<int>:                " << (long long) (v.capacity() - v.size()) * 4 + (long long) sizeof(v) << endl;
+    cout << "DynamicArray<int> (x2 growth):   " << (long long) (d2.capacity() - d2.size()) * 4 + (long long) sizeof(d2) << endl;
+    cout << "DynamicArray<int> (x1.5 growth): " << (long long) (d15.capacity() - d15.size()) * 4 + (long long) sizeof(d15) << endl;
+
+    return 0;
+}
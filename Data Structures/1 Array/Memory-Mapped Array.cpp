@@ -0,0 +1,347 @@
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <stdexcept>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+using namespace std;
+
+/*
+    Array.cpp and Space Complexity.cpp keep arrays in process memory, so an array saved to disk
+    has to be read back (deserialized) element by element on every start. For a large sorted
+    array of IDs this costs seconds to minutes and needs enough RAM for the whole array.
+
+    A memory-mapped array asks the operating system to map the file directly into the address
+    space with `mmap`. Opening takes microseconds regardless of size: no data is read until an
+    element is touched, and then only that page (4 KB) is loaded. Pages the process does not
+    use are never read, and pages that are no longer needed can be evicted by the OS, so the
+    array can be larger than RAM.
+
+    Modes:
+        - ReadOnly: the pages are shared with the page cache; writing is not allowed.
+        - CopyOnWrite: writes go to private copies of the touched pages and are never saved,
+          useful to sort or modify a temporary view of the data.
+        - ReadWrite: writes go back to the file (used to create and update files).
+
+    Access hints (`madvise`):
+        - Sequential: read ahead aggressively and drop pages behind the reader (full scans).
+        - Random: disable read-ahead (binary search, hash lookups).
+        - WillNeed: start loading the whole range in the background.
+
+    Huge-page alignment:
+        The mapping can be placed at a 2 MB aligned address. With transparent huge pages the
+        kernel can then back it with 2 MB pages, so one TLB entry covers 512 times more data.
+        Whether the kernel actually uses huge pages for a file mapping depends on the file
+        system and kernel configuration; the alignment is the part the program controls.
+
+    Time Complexity:
+        - Opening: O(1), independent of the file size.
+        - Access: O(1), plus a page fault (disk read) the first time each page is touched.
+
+    Space Complexity:
+        - O(1) in the process heap; resident memory is the set of pages actually touched.
+
+    Pros:
+        - No deserialization: the file format is the in-memory array.
+        - Arrays larger than RAM.
+
+    Cons:
+        - Only for trivially copyable types with a fixed layout (no pointers inside).
+        - An I/O error while reading a page is delivered as a signal (SIGBUS), not an error code.
+        - The file is tied to the machine's endianness and the type's layout.
+*/
+
+enum class MapMode { ReadOnly, CopyOnWrite, ReadWrite };
+enum class AccessPattern { Normal, Sequential, Random, WillNeed };
+
+template <typename T>
+class MappedArray {
+private:
+    static_assert(is_trivially_copyable<T>::value, "Mapped elements must be trivially copyable.");
+    static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    T *elements = nullptr;
+    size_t count = 0;
+    size_t mappedBytes = 0;
+    MapMode mode = MapMode::ReadOnly;
+
+    static runtime_error systemError(const string &what, const string &path) {
+        return runtime_error(what + " '" + path + "': " + strerror(errno));
+    }
+
+    // Maps `bytes` of the file, at a 2 MB aligned address when requested
+    static void *mapFile(int fd, size_t bytes, int protection, int flags, bool hugePageAligned) {
+        if (!hugePageAligned) {
+            return mmap(nullptr, bytes, protection, flags, fd, 0);
+        }
+
+        // Reserve enough address space to find an aligned start, then map the file over it
+        size_t reserved = bytes + HUGE_PAGE_SIZE;
+        void *region = mmap(nullptr, reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED) return MAP_FAILED;
+
+        uintptr_t start = reinterpret_cast<uintptr_t>(region);
+        uintptr_t aligned = (start + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        void *mapped = mmap(reinterpret_cast<void *>(aligned), bytes, protection, flags | MAP_FIXED, fd, 0);
+        if (mapped == MAP_FAILED) {
+            munmap(region, reserved);
+            return MAP_FAILED;
+        }
+
+        // Release the unused parts of the reservation before and after the mapping
+        if (aligned > start) munmap(region, aligned - start);
+        uintptr_t end = aligned + ((bytes + getpagesize() - 1) / getpagesize()) * getpagesize();
+        if (end < start + reserved) munmap(reinterpret_cast<void *>(end), start + reserved - end);
+
+#ifdef MADV_HUGEPAGE
+        madvise(mapped, bytes, MADV_HUGEPAGE); // A hint; ignored where unsupported
+#endif
+        return mapped;
+    }
+
+    void open(const string &path, MapMode mapMode, bool hugePageAligned, size_t createCount, bool create) {
+        int flags = mapMode == MapMode::ReadOnly ? O_RDONLY : O_RDWR;
+        if (mapMode == MapMode::CopyOnWrite) flags = O_RDONLY; // Private pages never reach the file
+        if (create) flags = O_RDWR | O_CREAT | O_TRUNC;
+
+        int fd = ::open(path.c_str(), flags, 0644);
+        if (fd < 0) throw systemError("Cannot open", path);
+
+        size_t bytes;
+        if (create) {
+            bytes = createCount * sizeof(T);
+            if (ftruncate(fd, (off_t) bytes) != 0) {
+                runtime_error error = systemError("Cannot resize", path); // Before close() can change errno
+                close(fd);
+                throw error;
+            }
+        } else {
+            struct stat info;
+            if (fstat(fd, &info) != 0) {
+                runtime_error error = systemError("Cannot stat", path);
+                close(fd);
+                throw error;
+            }
+            bytes = (size_t) info.st_size;
+            if (bytes % sizeof(T) != 0) {
+                close(fd);
+                throw runtime_error("File '" + path + "' is not a whole number of elements.");
+            }
+        }
+
+        if (bytes > 0) {
+            int protection = mapMode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+            int mapFlags = mapMode == MapMode::ReadWrite ? MAP_SHARED : MAP_PRIVATE;
+            void *mapped = mapFile(fd, bytes, protection, mapFlags, hugePageAligned);
+            if (mapped == MAP_FAILED) {
+                runtime_error error = systemError("Cannot map", path);
+                close(fd);
+                throw error;
+            }
+            elements = static_cast<T *>(mapped);
+        }
+        close(fd); // The mapping keeps its own reference to the file
+
+        count = bytes / sizeof(T);
+        mappedBytes = bytes;
+        mode = mapMode;
+    }
+
+    MappedArray() = default;
+
+public:
+    // Maps an existing file of T values
+    MappedArray(const string &path, MapMode mode, bool hugePageAligned = false) {
+        open(path, mode, hugePageAligned, 0, false);
+    }
+
+    // Creates (or truncates) a file holding `count` zeroed elements, mapped ReadWrite
+    static MappedArray create(const string &path, size_t count, bool hugePageAligned = false) {
+        MappedArray array;
+        array.open(path, MapMode::ReadWrite, hugePageAligned, count, true);
+        return array;
+    }
+
+    MappedArray(const MappedArray &) = delete;
+    MappedArray &operator=(const MappedArray &) = delete;
+
+    MappedArray(MappedArray &&other) noexcept
+        : elements(other.elements), count(other.count), mappedBytes(other.mappedBytes), mode(other.mode) {
+        other.elements = nullptr;
+        other.count = 0;
+        other.mappedBytes = 0;
+    }
+
+    ~MappedArray() {
+        if (elements) munmap(elements, mappedBytes);
+    }
+
+    size_t size() const { return count; }
+    MapMode mapMode() const { return mode; }
+    bool isHugePageAligned() const { return reinterpret_cast<uintptr_t>(elements) % HUGE_PAGE_SIZE == 0; }
+
+    const T &operator[](size_t index) const { return elements[index]; }
+    const T *data() const { return elements; }
+
+    // Writable access; not available for ReadOnly mappings
+    T *mutableData() {
+        if (mode == MapMode::ReadOnly) throw logic_error("A ReadOnly mapping cannot be written.");
+        return elements;
+    }
+
+    // Tells the kernel how the array is about to be accessed
+    void advise(AccessPattern pattern) {
+        if (!elements) return;
+        int advice = MADV_NORMAL;
+        if (pattern == AccessPattern::Sequential) advice = MADV_SEQUENTIAL;
+        if (pattern == AccessPattern::Random) advice = MADV_RANDOM;
+        if (pattern == AccessPattern::WillNeed) advice = MADV_WILLNEED;
+        madvise(elements, mappedBytes, advice);
+    }
+
+    // Writes modified pages of a ReadWrite mapping back to the file
+    void sync() {
+        if (elements && mode == MapMode::ReadWrite) msync(elements, mappedBytes, MS_SYNC);
+    }
+};
+
+/*
+    Routines from the Algorithms folder, with long long indices so that arrays beyond
+    2^31 elements work
+*/
+
+// binarySearchRecursive from Binary Search.cpp
+template <typename T>
+long long binarySearchRecursive(const T *arr, long long left, long long right, const T &target) {
+    if (left <= right) {
+        long long mid = left + (right - left) / 2;
+
+        if (arr[mid] == target) {
+            return mid;
+        } else if (arr[mid] < target) {
+            return binarySearchRecursive(arr, mid + 1, right, target);
+        } else {
+            return binarySearchRecursive(arr, left, mid - 1, target);
+        }
+    }
+    return -1;
+}
+
+// QuickSort from Quick Sort A.cpp; sorts in place, so it needs no buffer as large as the file.
+// The pivot comes from a 64-bit generator (rand() stops at RAND_MAX, which is often 32767, far
+// below the size of a large file), and only the smaller side is sorted recursively, so the
+// recursion is at most log2(n) deep.
+template <typename T>
+void QuickSort(T *arr, long long left, long long right) {
+    static mt19937_64 pivotGenerator(38);
+    while (right - left > 1) {
+        long long leftIndex = left;
+        long long rightIndex = right - 1;
+        long long size = right - left;
+
+        T pivot = arr[(long long) (pivotGenerator() % (unsigned long long) size) + leftIndex];
+        while (leftIndex < rightIndex) {
+            while (arr[rightIndex] > pivot && rightIndex > leftIndex) {
+                rightIndex--;
+            }
+            while (arr[leftIndex] < pivot && leftIndex <= rightIndex) {
+                leftIndex++;
+            }
+            if (leftIndex < rightIndex) {
+                swap(arr[leftIndex], arr[rightIndex]);
+                leftIndex++;
+            }
+        }
+        if (leftIndex - left < right - rightIndex) {
+            QuickSort(arr, left, leftIndex);
+            left = rightIndex; // Continue with the larger side in this loop
+        } else {
+            QuickSort(arr, rightIndex, right);
+            right = leftIndex;
+        }
+    }
+}
+
+// Microseconds elapsed while running `function`
+template <typename Function>
+double microsecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, micro>(end - start).count();
+}
+
+int main() {
+    const string path = "mapped_array_demo.bin";
+    const size_t N = 16 * 1024 * 1024; // 64 MB of int
+    mt19937 rng(11);
+
+    try {
+        // Create the file through a ReadWrite mapping: random values, saved to disk
+        {
+            MappedArray<int> file = MappedArray<int>::create(path, N);
+            file.advise(AccessPattern::Sequential);
+            int *values = file.mutableData();
+            for (size_t i = 0; i < N; i++) values[i] = (int) (rng() % 1000000000);
+            file.sync();
+        }
+
+        // Sort a CopyOnWrite view: the sorted pages stay private, the file is unchanged
+        {
+            MappedArray<int> view(path, MapMode::CopyOnWrite);
+            int first = view[0];
+            double sortTime = microsecondsFor([&]() { QuickSort(view.mutableData(), 0, (long long) view.size()); });
+            cout << "Sorted a CopyOnWrite view of " << view.size() << " ints in " << sortTime / 1000 << " ms" << endl;
+
+            MappedArray<int> original(path, MapMode::ReadOnly);
+            cout << "File unchanged by the private sort: " << (original[0] == first ? "yes" : "no") << endl;
+        }
+
+        // Persist a sorted copy through a ReadWrite mapping
+        {
+            MappedArray<int> file(path, MapMode::ReadWrite);
+            QuickSort(file.mutableData(), 0, (long long) file.size());
+            file.sync();
+        }
+
+        // Reopen: mapping is instant, only the pages touched by the search are read
+        auto openStart = chrono::steady_clock::now();
+        MappedArray<int> sortedIds(path, MapMode::ReadOnly, true);
+        double openTime = chrono::duration<double, micro>(chrono::steady_clock::now() - openStart).count();
+        sortedIds.advise(AccessPattern::Random);
+        cout << "\nOpened " << sortedIds.size() * sizeof(int) / (1024 * 1024) << " MB ReadOnly in " << openTime << " us"
+             << ", 2 MB aligned: " << (sortedIds.isHugePageAligned() ? "yes" : "no") << endl;
+
+        const int LOOKUPS = 1000000;
+        int found = 0;
+        double searchTime = microsecondsFor([&]() {
+            for (int i = 0; i < LOOKUPS; i++) {
+                int target = sortedIds[rng() % N];
+                if (binarySearchRecursive(sortedIds.data(), 0, (long long) N - 1, target) != -1) found++;
+            }
+        });
+        cout << LOOKUPS << " binary searches: " << searchTime / 1000 << " ms, found " << found << endl;
+
+        // Errors are reported with exceptions
+        try {
+            MappedArray<int> missing("no_such_file.bin", MapMode::ReadOnly);
+        } catch (const runtime_error &e) {
+            cout << "\n" << e.what() << endl;
+        }
+    } catch (const exception &e) {
+        cout << "Error: " << e.what() << endl;
+        unlink(path.c_str());
+        return 1;
+    }
+
+    unlink(path.c_str());
+    return 0;
+}
@@ -0,0 +1,386 @@
+#include <iostream>
+#include <vector>
+#include <array>
+#include <tuple>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/*
+    The data structures in this folder store records as an Array of Structs (AoS): every
+    record keeps its fields next to each other, like `SinglyNode{data, next}`. A scan that
+    reads one field still pulls every other field of the record into the cache, because
+    memory is loaded in 64-byte cache lines.
+
+    A Structure of Arrays (SoA) stores each field in its own contiguous array (a column):
+
+        AoS: [id price qty region ...][id price qty region ...][id price qty region ...]
+        SoA: id:     [id id id ...]
+             price:  [price price price ...]
+             qty:    [qty qty qty ...]
+
+    Summing `price` over an SoA table reads only the price column, so every byte brought into
+    the cache is used, and the compiler can vectorize the loop. With records of 20 fields, a
+    scan of one field moves about 20 times less memory.
+
+    `StructOfArrays<Fields...>`:
+        - One 64-byte aligned column per field; columns grow together on push_back.
+        - `column<I>()` returns a pointer to column I for tight loops.
+        - `row(i)` returns a proxy whose `get<I>()` reads or writes one field of row i, so
+          record-style code still works.
+        - `sortByColumn<I>()` sorts the whole table by one column with the merge sort from
+          Merge Sort.cpp applied to a row order, then rearranges every column once.
+        - `binarySearchColumn<I>(target)` runs the binary search from Binary Search.cpp on a
+          sorted column.
+
+    Time Complexity:
+        - push_back: amortized O(number of fields).
+        - Field access: O(1).
+        - sortByColumn: O(n log n) comparisons plus O(n * number of fields) to rearrange.
+        - binarySearchColumn: O(log n).
+
+    Space Complexity:
+        - O(n) per column; sortByColumn uses O(n) extra for the row order.
+
+    Pros:
+        - Scans and filters that read few fields use far less memory bandwidth.
+        - Columns are contiguous and aligned, ideal for SIMD.
+
+    Cons:
+        - Reading or writing a whole record touches one cache line per field.
+        - Inserting a row writes to every column.
+
+    Note:
+        Fields must be trivially copyable (numbers, plain structs, std::array), since columns
+        are grown and rearranged with memcpy.
+*/
+
+// Growable, 64-byte aligned array of one field
+template <typename T>
+class AlignedColumn {
+private:
+    static_assert(is_trivially_copyable<T>::value, "Columns hold trivially copyable fields.");
+    static const size_t ALIGNMENT = 64;
+
+    T *values = nullptr;
+    size_t capacityValue = 0;
+
+public:
+    AlignedColumn() = default;
+    AlignedColumn(const AlignedColumn &) = delete;
+    AlignedColumn &operator=(const AlignedColumn &) = delete;
+    ~AlignedColumn() { free(values); }
+
+    T *data() { return values; }
+    const T *data() const { return values; }
+
+    // Grows to hold at least `n` values, keeping the first `used` of them
+    void reserve(size_t n, size_t used) {
+        if (n <= capacityValue) return;
+        size_t bytes = (n * sizeof(T) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        T *grown = static_cast<T *>(aligned_alloc(ALIGNMENT, bytes));
+        if (!grown) throw bad_alloc();
+        if (used > 0) memcpy(static_cast<void *>(grown), static_cast<const void *>(values), used * sizeof(T));
+        free(values);
+        values = grown;
+        capacityValue = n;
+    }
+
+    // Rearranges the values so that position i holds the value previously at order[i]
+    void permute(const int *order, size_t used, T *scratch) {
+        for (size_t i = 0; i < used; i++) scratch[i] = values[order[i]];
+        memcpy(static_cast<void *>(values), static_cast<const void *>(scratch), used * sizeof(T));
+    }
+};
+
+template <typename... Fields>
+class StructOfArrays {
+private:
+    using Row = tuple<Fields...>;
+    template <size_t I>
+    using FieldType = typename tuple_element<I, Row>::type;
+
+    tuple<AlignedColumn<Fields>...> columns;
+    size_t rows = 0;
+    size_t capacityValue = 0;
+
+    template <size_t... I>
+    void reserveAll(size_t n, index_sequence<I...>) {
+        (get<I>(columns).reserve(n, rows), ...);
+    }
+
+    template <size_t... I>
+    void storeRow(size_t r, const Row &values, index_sequence<I...>) {
+        ((get<I>(columns).data()[r] = get<I>(values)), ...);
+    }
+
+    template <size_t... I>
+    Row loadRow(size_t r, index_sequence<I...>) const {
+        return Row(get<I>(columns).data()[r]...);
+    }
+
+    template <size_t... I>
+    void permuteAll(const int *order, index_sequence<I...>) {
+        (permuteColumn<I>(order), ...);
+    }
+
+    template <size_t I>
+    void permuteColumn(const int *order) {
+        vector<FieldType<I>> scratch(rows);
+        get<I>(columns).permute(order, rows, scratch.data());
+    }
+
+    // mergeHalves from Merge Sort.cpp, comparing rows by their key instead of by value
+    template <typename Key>
+    static void mergeHalves(int *order, int left, int mid, int right, const Key *keys, vector<int> &merged) {
+        int leftIndex = left;
+        int rightIndex = mid + 1;
+        int mergedIndex = 0;
+
+        while (leftIndex <= mid && rightIndex <= right) {
+            if (keys[order[leftIndex]] <= keys[order[rightIndex]]) {
+                merged[mergedIndex++] = order[leftIndex++];
+            } else {
+                merged[mergedIndex++] = order[rightIndex++];
+            }
+        }
+        while (leftIndex <= mid) {
+            merged[mergedIndex++] = order[leftIndex++];
+        }
+        while (rightIndex <= right) {
+            merged[mergedIndex++] = order[rightIndex++];
+        }
+        for (int i = left, j = 0; i <= right; i++, j++) {
+            order[i] = merged[j];
+        }
+    }
+
+    // mergeSortRecursive from Merge Sort.cpp over row numbers; stable, so equal keys keep their order
+    template <typename Key>
+    static void mergeSortRecursive(int *order, int left, int right, const Key *keys, vector<int> &merged) {
+        if (left < right) {
+            int mid = (left + right) / 2;
+            mergeSortRecursive(order, left, mid, keys, merged);
+            mergeSortRecursive(order, mid + 1, right, keys, merged);
+            mergeHalves(order, left, mid, right, keys, merged);
+        }
+    }
+
+    // binarySearchRecursive from Binary Search.cpp, for any ordered column type
+    template <typename Key>
+    static int binarySearchRecursive(const Key *arr, int left, int right, const Key &target) {
+        if (left <= right) {
+            int mid = left + (right - left) / 2;
+
+            if (arr[mid] == target) {
+                return mid;
+            } else if (arr[mid] < target) {
+                return binarySearchRecursive(arr, mid + 1, right, target);
+            } else {
+                return binarySearchRecursive(arr, left, mid - 1, target);
+            }
+        }
+        return -1;
+    }
+
+public:
+    // Proxy for one row; reads and writes go straight to the columns
+    class RowRef {
+    private:
+        StructOfArrays *table;
+        size_t index;
+
+    public:
+        RowRef(StructOfArrays *table, size_t index) : table(table), index(index) {}
+
+        template <size_t I>
+        FieldType<I> &get() { return table->template column<I>()[index]; }
+
+        // Copies the whole record out
+        operator Row() const { return table->loadRow(index, index_sequence_for<Fields...>()); }
+
+        RowRef &operator=(const Row &values) {
+            table->storeRow(index, values, index_sequence_for<Fields...>());
+            return *this;
+        }
+    };
+
+    StructOfArrays() = default;
+    StructOfArrays(const StructOfArrays &) = delete;
+    StructOfArrays &operator=(const StructOfArrays &) = delete;
+
+    size_t size() const { return rows; }
+    bool isEmpty() const { return rows == 0; }
+
+    template <size_t I>
+    FieldType<I> *column() { return get<I>(columns).data(); }
+
+    template <size_t I>
+    const FieldType<I> *column() const { return get<I>(columns).data(); }
+
+    RowRef row(size_t index) { return RowRef(this, index); }
+
+    void reserve(size_t n) {
+        if (n <= capacityValue) return;
+        reserveAll(n, index_sequence_for<Fields...>());
+        capacityValue = n;
+    }
+
+    // Appends one record, writing one value to each column
+    void push_back(const Fields &... values) {
+        Row row(values...); // Built first: a value may refer into a column that is about to move
+        if (rows == capacityValue) reserve(capacityValue == 0 ? 16 : capacityValue * 2);
+        storeRow(rows, row, index_sequence_for<Fields...>());
+        rows++;
+    }
+
+    // Sorts every row by column I (ascending, stable)
+    template <size_t I>
+    void sortByColumn() {
+        if (rows < 2) return;
+        vector<int> order(rows);
+        for (size_t i = 0; i < rows; i++) order[i] = (int) i;
+        vector<int> merged(rows);
+        mergeSortRecursive(order.data(), 0, (int) rows - 1, column<I>(), merged);
+        permuteAll(order.data(), index_sequence_for<Fields...>());
+    }
+
+    // Row index holding `target` in column I, or -1; column I must be sorted
+    template <size_t I>
+    int binarySearchColumn(const FieldType<I> &target) const {
+        return binarySearchRecursive(column<I>(), 0, (int) rows - 1, target);
+    }
+};
+
+/*
+    Benchmark: the same trades stored as AoS and as SoA
+*/
+
+const int EXTRA_FIELDS = 16;
+
+// A wide record: 4 fields used by the queries and 16 that are not
+struct Trade {
+    long long id;
+    double price;
+    int quantity;
+    int region;
+    double extra[EXTRA_FIELDS];
+};
+
+enum TradeColumn { ID, PRICE, QUANTITY, REGION, EXTRA };
+
+using TradeTable = StructOfArrays<long long, double, int, int, array<double, EXTRA_FIELDS>>;
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+volatile double soaSink; // Keeps benchmarked results alive
+
+int main() {
+
+    // Basic usage
+    TradeTable table;
+    array<double, EXTRA_FIELDS> none{};
+    table.push_back(3, 10.5, 100, 1, none);
+    table.push_back(1, 99.0, 5, 2, none);
+    table.push_back(2, 42.25, 40, 1, none);
+
+    table.row(1).get<QUANTITY>() += 10;
+
+    table.sortByColumn<ID>();
+    cout << "Trades sorted by id:" << endl;
+    for (size_t i = 0; i < table.size(); i++) {
+        auto row = table.row(i);
+        cout << "  id " << row.get<ID>() << ", price " << row.get<PRICE>() << ", quantity " << row.get<QUANTITY>() << endl;
+    }
+    cout << "binarySearchColumn<ID>(2): row " << table.binarySearchColumn<ID>(2) << endl;
+    cout << "binarySearchColumn<ID>(7): row " << table.binarySearchColumn<ID>(7) << endl;
+
+    // Scan and filter workloads
+    const int N = 2000000;
+    mt19937 rng(5);
+    vector<Trade> aos(N);
+    TradeTable soa;
+    soa.reserve(N);
+    for (int i = 0; i < N; i++) {
+        Trade t;
+        t.id = i;
+        t.price = (rng() % 100000) / 100.0;
+        t.quantity = rng() % 1000;
+        t.region = rng() % 8;
+        for (int k = 0; k < EXTRA_FIELDS; k++) t.extra[k] = k;
+        aos[i] = t;
+        array<double, EXTRA_FIELDS> extra;
+        for (int k = 0; k < EXTRA_FIELDS; k++) extra[k] = t.extra[k];
+        soa.push_back(t.id, t.price, t.quantity, t.region, extra);
+    }
+
+    cout << "\nBenchmark: " << N << " trades, sizeof(Trade) = " << sizeof(Trade) << " bytes" << endl;
+
+    const int ROUNDS = 10;
+    double aosScan = millisecondsFor([&]() {
+        double total = 0;
+        for (int r = 0; r < ROUNDS; r++) {
+            for (int i = 0; i < N; i++) total += aos[i].price;
+        }
+        soaSink = total;
+    });
+    double soaScan = millisecondsFor([&]() {
+        double total = 0;
+        const double *price = soa.column<PRICE>();
+        for (int r = 0; r < ROUNDS; r++) {
+            for (int i = 0; i < N; i++) total += price[i];
+        }
+        soaSink = total;
+    });
+    cout << "Scan (sum of price), " << ROUNDS << " rounds:" << endl;
+    cout << "  AoS: " << aosScan << " ms" << endl;
+    cout << "  SoA: " << soaScan << " ms" << endl;
+
+    double aosFilter = millisecondsFor([&]() {
+        double total = 0;
+        for (int r = 0; r < ROUNDS; r++) {
+            for (int i = 0; i < N; i++) {
+                if (aos[i].region == 3) total += aos[i].price * aos[i].quantity;
+            }
+        }
+        soaSink = total;
+    });
+    double soaFilter = millisecondsFor([&]() {
+        double total = 0;
+        const int *region = soa.column<REGION>();
+        const double *price = soa.column<PRICE>();
+        const int *quantity = soa.column<QUANTITY>();
+        for (int r = 0; r < ROUNDS; r++) {
+            for (int i = 0; i < N; i++) {
+                if (region[i] == 3) total += price[i] * quantity[i];
+            }
+        }
+        soaSink = total;
+    });
+    cout << "Filter (revenue where region == 3), " << ROUNDS << " rounds:" << endl;
+    cout << "  AoS: " << aosFilter << " ms" << endl;
+    cout << "  SoA: " << soaFilter << " ms" << endl;
+
+    double soaSort = millisecondsFor([&]() { soa.sortByColumn<PRICE>(); });
+    const double *sortedPrice = soa.column<PRICE>();
+    bool sorted = true;
+    for (int i = 1; i < N; i++) {
+        if (sortedPrice[i - 1] > sortedPrice[i]) sorted = false;
+    }
+    cout << "\nsortByColumn<PRICE> on " << N << " rows: " << soaSort << " ms, sorted: " << (sorted ? "yes" : "no") << endl;
+
+    return 0;
+}
@@ -0,0 +1,539 @@
+#include <iostream>
+#include <list>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+using namespace std;
+
+/*
+    Every list so far owns its nodes: `node(int x)` in Linked List Operations.cpp or
+    `SinglyNode{data, next}` in Linked List and Types.cpp wrap the payload in a separately
+    allocated node. When the objects already live somewhere else (an arena, a vector, a pool),
+    the list still allocates a node per element and the node only points at, or copies, the
+    object.
+
+    An intrusive list turns this around: the link pointers (the "hook") are embedded in the
+    user's struct, and the list links the objects themselves:
+
+        struct Task : DoublyHook<ReadyTag>, DoublyHook<AllTag> {
+            int id;
+        };
+
+    Adding an object to a list only writes its hook, so it never allocates. Given a reference
+    to an object, the doubly linked list can unlink it in O(1), without searching for it.
+    An object can be in several lists at once, with one hook per list, told apart by a tag type.
+
+    Containers:
+        - IntrusiveSinglyList: one `next` pointer per object; push/pop at the front,
+          insertAfter / eraseAfter. Removing an arbitrary object needs its predecessor.
+        - IntrusiveList: doubly linked through a sentinel hook (circular internally, so there
+          are no null checks); push/pop at both ends, insertBefore and O(1) erase of any object.
+        - IntrusiveCircularList: singly linked ring that keeps only the tail (tail->next is the
+          head); push at both ends, pop at the front and rotate, e.g. for round-robin scheduling.
+
+    The lists never own the objects: they neither allocate nor free them. An object must be
+    removed from every list before it is destroyed or moved.
+
+    Time Complexity:
+        - Push, pop, insert next to a known object, IntrusiveList::erase: O(1).
+        - IntrusiveSinglyList::remove (finds the predecessor): O(n).
+
+    Space Complexity:
+        - One or two pointers inside each object per list; no allocation at all.
+
+    Pros:
+        - No allocation and no copying on insert/remove, and no separate node to chase.
+        - O(1) removal from the middle given only the object.
+
+    Cons:
+        - The object's type must be changed to carry the hooks.
+        - Lifetime is the user's responsibility: a destroyed object that is still linked
+          leaves dangling pointers in the list.
+*/
+
+struct DefaultTag {};
+
+// Hook for singly linked intrusive lists; Tag tells hooks for different lists apart
+template <typename Tag = DefaultTag>
+struct SinglyHook {
+    SinglyHook *next = nullptr;
+
+    // A copied object starts outside every list
+    SinglyHook() = default;
+    SinglyHook(const SinglyHook &) {}
+    SinglyHook &operator=(const SinglyHook &) { return *this; }
+};
+
+// Hook for the doubly linked intrusive list; unlinked hooks point nowhere
+template <typename Tag = DefaultTag>
+struct DoublyHook {
+    DoublyHook *prev = nullptr;
+    DoublyHook *next = nullptr;
+
+    DoublyHook() = default;
+    DoublyHook(const DoublyHook &) {}
+    DoublyHook &operator=(const DoublyHook &) { return *this; }
+
+    bool isLinked() const {
+        return next != nullptr;
+    }
+};
+
+/*
+    Singly linked intrusive list
+*/
+
+template <typename T, typename Tag = DefaultTag>
+class IntrusiveSinglyList {
+private:
+    using Hook = SinglyHook<Tag>;
+
+    Hook *head;
+    int size;
+
+    static Hook *hookOf(T &item) { return static_cast<Hook *>(&item); }
+    static T *itemOf(Hook *hook) { return static_cast<T *>(hook); }
+
+public:
+    IntrusiveSinglyList() : head(nullptr), size(0) {}
+
+    IntrusiveSinglyList(const IntrusiveSinglyList &) = delete;
+    IntrusiveSinglyList &operator=(const IntrusiveSinglyList &) = delete;
+
+    bool isEmpty() const { return head == nullptr; }
+    int countNodes() const { return size; }
+
+    T &front() {
+        if (!head) throw out_of_range("front on an empty list");
+        return *itemOf(head);
+    }
+
+    void pushFront(T &item) {
+        Hook *hook = hookOf(item);
+        hook->next = head;
+        head = hook;
+        size++;
+    }
+
+    // Unlinks and returns the first object, or nullptr when the list is empty
+    T *popFront() {
+        if (!head) return nullptr;
+        Hook *hook = head;
+        head = hook->next;
+        hook->next = nullptr;
+        size--;
+        return itemOf(hook);
+    }
+
+    // Links `item` right after `position`, which must be in this list
+    void insertAfter(T &position, T &item) {
+        Hook *previous = hookOf(position);
+        Hook *hook = hookOf(item);
+        hook->next = previous->next;
+        previous->next = hook;
+        size++;
+    }
+
+    // Unlinks and returns the object after `position`, or nullptr if it is the last one
+    T *eraseAfter(T &position) {
+        Hook *previous = hookOf(position);
+        Hook *hook = previous->next;
+        if (!hook) return nullptr;
+        previous->next = hook->next;
+        hook->next = nullptr;
+        size--;
+        return itemOf(hook);
+    }
+
+    // Unlinks `item`; walks the list to find its predecessor. Returns false if it is not here
+    bool remove(T &item) {
+        Hook *target = hookOf(item);
+        for (Hook **link = &head; *link; link = &(*link)->next) {
+            if (*link != target) continue;
+            *link = target->next;
+            target->next = nullptr;
+            size--;
+            return true;
+        }
+        return false;
+    }
+
+    template <typename Visit>
+    void forEach(Visit visit) {
+        for (Hook *hook = head; hook; hook = hook->next) visit(*itemOf(hook));
+    }
+
+    // Forgets all objects without touching them
+    void clear() {
+        head = nullptr;
+        size = 0;
+    }
+};
+
+/*
+    Doubly linked intrusive list
+*/
+
+template <typename T, typename Tag = DefaultTag>
+class IntrusiveList {
+private:
+    using Hook = DoublyHook<Tag>;
+
+    Hook sentinel; // sentinel.next is the first object, sentinel.prev the last
+    int size;
+
+    static Hook *hookOf(T &item) { return static_cast<Hook *>(&item); }
+    static T *itemOf(Hook *hook) { return static_cast<T *>(hook); }
+
+    // Links `hook` between two adjacent hooks
+    void linkBetween(Hook *hook, Hook *before, Hook *after) {
+        if (hook->isLinked()) throw logic_error("object is already in a list with this hook");
+        hook->prev = before;
+        hook->next = after;
+        before->next = hook;
+        after->prev = hook;
+        size++;
+    }
+
+    void unlink(Hook *hook) {
+        hook->prev->next = hook->next;
+        hook->next->prev = hook->prev;
+        hook->prev = hook->next = nullptr;
+        size--;
+    }
+
+public:
+    IntrusiveList() : size(0) {
+        sentinel.prev = sentinel.next = &sentinel;
+    }
+
+    IntrusiveList(const IntrusiveList &) = delete;
+    IntrusiveList &operator=(const IntrusiveList &) = delete;
+
+    ~IntrusiveList() {
+        clear();
+    }
+
+    bool isEmpty() const { return sentinel.next == &sentinel; }
+    int countNodes() const { return size; }
+
+    T &front() {
+        if (isEmpty()) throw out_of_range("front on an empty list");
+        return *itemOf(sentinel.next);
+    }
+
+    T &back() {
+        if (isEmpty()) throw out_of_range("back on an empty list");
+        return *itemOf(sentinel.prev);
+    }
+
+    void pushFront(T &item) { linkBetween(hookOf(item), &sentinel, sentinel.next); }
+    void pushBack(T &item) { linkBetween(hookOf(item), sentinel.prev, &sentinel); }
+
+    // Links `item` right before `position`, which must be in this list
+    void insertBefore(T &position, T &item) {
+        Hook *after = hookOf(position);
+        linkBetween(hookOf(item), after->prev, after);
+    }
+
+    // Unlinks and returns the first / last object, or nullptr when the list is empty
+    T *popFront() {
+        if (isEmpty()) return nullptr;
+        Hook *hook = sentinel.next;
+        unlink(hook);
+        return itemOf(hook);
+    }
+
+    T *popBack() {
+        if (isEmpty()) return nullptr;
+        Hook *hook = sentinel.prev;
+        unlink(hook);
+        return itemOf(hook);
+    }
+
+    // Unlinks `item` in O(1); it must be in this list
+    void erase(T &item) {
+        Hook *hook = hookOf(item);
+        if (!hook->isLinked()) throw logic_error("erase of an object that is not in a list");
+        unlink(hook);
+    }
+
+    // Neighbours of `item`, or nullptr at the ends
+    T *next(T &item) {
+        Hook *hook = hookOf(item)->next;
+        return hook == &sentinel ? nullptr : itemOf(hook);
+    }
+
+    T *prev(T &item) {
+        Hook *hook = hookOf(item)->prev;
+        return hook == &sentinel ? nullptr : itemOf(hook);
+    }
+
+    template <typename Visit>
+    void forEach(Visit visit) {
+        for (Hook *hook = sentinel.next; hook != &sentinel; hook = hook->next) visit(*itemOf(hook));
+    }
+
+    template <typename Visit>
+    void forEachReverse(Visit visit) {
+        for (Hook *hook = sentinel.prev; hook != &sentinel; hook = hook->prev) visit(*itemOf(hook));
+    }
+
+    // Unlinks every object, so they can join other lists or be destroyed
+    void clear() {
+        Hook *hook = sentinel.next;
+        while (hook != &sentinel) {
+            Hook *next = hook->next;
+            hook->prev = hook->next = nullptr;
+            hook = next;
+        }
+        sentinel.prev = sentinel.next = &sentinel;
+        size = 0;
+    }
+};
+
+/*
+    Circular intrusive list
+*/
+
+template <typename T, typename Tag = DefaultTag>
+class IntrusiveCircularList {
+private:
+    using Hook = SinglyHook<Tag>;
+
+    Hook *tail; // tail->next is the head; nullptr when empty
+    int size;
+
+    static Hook *hookOf(T &item) { return static_cast<Hook *>(&item); }
+    static T *itemOf(Hook *hook) { return static_cast<T *>(hook); }
+
+public:
+    IntrusiveCircularList() : tail(nullptr), size(0) {}
+
+    IntrusiveCircularList(const IntrusiveCircularList &) = delete;
+    IntrusiveCircularList &operator=(const IntrusiveCircularList &) = delete;
+
+    bool isEmpty() const { return tail == nullptr; }
+    int countNodes() const { return size; }
+
+    T &front() {
+        if (!tail) throw out_of_range("front on an empty list");
+        return *itemOf(tail->next);
+    }
+
+    void pushFront(T &item) {
+        Hook *hook = hookOf(item);
+        if (!tail) {
+            hook->next = hook; // A single object points to itself
+            tail = hook;
+        } else {
+            hook->next = tail->next;
+            tail->next = hook;
+        }
+        size++;
+    }
+
+    // Linking at the front and moving the tail onto the new object appends it
+    void pushBack(T &item) {
+        pushFront(item);
+        tail = hookOf(item);
+    }
+
+    // Unlinks and returns the head, or nullptr when the list is empty
+    T *popFront() {
+        if (!tail) return nullptr;
+        Hook *hook = tail->next;
+        if (hook == tail) tail = nullptr;
+        else tail->next = hook->next;
+        hook->next = nullptr;
+        size--;
+        return itemOf(hook);
+    }
+
+    // Moves the head to the back: the next object becomes the head
+    void rotate() {
+        if (tail) tail = tail->next;
+    }
+
+    // Visits every object once, starting at the head
+    template <typename Visit>
+    void forEach(Visit visit) {
+        if (!tail) return;
+        Hook *hook = tail->next;
+        do {
+            Hook *next = hook->next;
+            visit(*itemOf(hook));
+            hook = next;
+        } while (hook != tail->next);
+    }
+
+    void clear() {
+        tail = nullptr;
+        size = 0;
+    }
+};
+
+// LinkedList from Linked List Operations.cpp, for the benchmark, without that program's main
+#define WITHOUT_MAIN
+#include "../2 Linked List Operations/Linked List Operations.cpp"
+#undef WITHOUT_MAIN
+
+/*
+    Benchmark
+*/
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+volatile long long listSink; // Keeps benchmarked results alive
+
+struct ReadyTag {};
+struct AllTag {};
+
+// An object that is in two lists at once: all tasks, and the tasks ready to run
+struct Task : DoublyHook<ReadyTag>, DoublyHook<AllTag>, SinglyHook<> {
+    int id;
+    Task(int id = 0) : id(id) {}
+};
+
+// Benchmark object with a single hook
+struct Item : DoublyHook<> {
+    int id = 0;
+};
+
+int main() {
+    vector<Task> tasks; // The objects live in an arena; the lists only link them
+    for (int i = 0; i < 6; i++) tasks.emplace_back(i);
+
+    IntrusiveList<Task, AllTag> all;
+    IntrusiveList<Task, ReadyTag> ready;
+    for (Task &task : tasks) all.pushBack(task);
+    for (int i : {4, 1, 3}) ready.pushBack(tasks[i]);
+
+    auto printIds = [](Task &task) { cout << task.id << " "; };
+    cout << "All tasks:   ";
+    all.forEach(printIds);
+    cout << "\nReady tasks: ";
+    ready.forEach(printIds);
+
+    ready.erase(tasks[1]); // O(1), no search
+    all.erase(tasks[1]);
+    cout << "\nAfter erasing task 1 from both lists:" << endl;
+    cout << "All tasks:   ";
+    all.forEach(printIds);
+    cout << "\nReady tasks: ";
+    ready.forEach(printIds);
+    cout << "\nAll tasks backwards: ";
+    all.forEachReverse(printIds);
+    cout << endl;
+
+    IntrusiveCircularList<Task> roundRobin;
+    for (int i : {0, 2, 5}) roundRobin.pushBack(tasks[i]);
+    cout << "Round robin turns: ";
+    for (int turn = 0; turn < 7; turn++) {
+        cout << roundRobin.front().id << " ";
+        roundRobin.rotate();
+    }
+    cout << endl;
+    roundRobin.clear();
+
+    IntrusiveSinglyList<Task> stack;
+    for (int i : {0, 2, 5}) stack.pushFront(tasks[i]);
+    stack.remove(tasks[2]);
+    cout << "Singly list after removing 2: ";
+    stack.forEach(printIds);
+    cout << endl;
+    stack.clear();
+    all.clear();
+    ready.clear();
+
+    // Benchmark: a queue of N objects where the front object is repeatedly moved to the back
+    const int N = 1000000;
+    const int OPERATIONS = 10000000;
+
+    vector<Item> arena(N);
+    for (int i = 0; i < N; i++) arena[i].id = i;
+
+    IntrusiveList<Item> intrusive;
+    for (Item &item : arena) intrusive.pushBack(item);
+    double intrusiveFifo = millisecondsFor([&]() {
+        for (int i = 0; i < OPERATIONS; i++) intrusive.pushBack(*intrusive.popFront());
+        listSink = intrusive.front().id;
+    });
+
+    list<int> standard;
+    for (int i = 0; i < N; i++) standard.push_back(i);
+    double standardFifo = millisecondsFor([&]() {
+        for (int i = 0; i < OPERATIONS; i++) {
+            int value = standard.front();
+            standard.pop_front(); // Frees the node...
+            standard.push_back(value); // ...and allocates a new one
+        }
+        listSink = standard.front();
+    });
+
+    LinkedList<> linked;
+    for (int i = 0; i < N; i++) linked.addAtEnd(i);
+    double linkedFifo = millisecondsFor([&]() {
+        for (int i = 0; i < OPERATIONS; i++) {
+            node* front = linked.deleteNode(linked.head->data); // Matches the head: O(1)
+            int value = front->data;
+            delete front;
+            linked.addAtEnd(new node(value));
+        }
+        listSink = linked.head->data;
+    });
+
+    // Benchmark: remove a random object from the middle and append it again
+    mt19937 rng(46);
+    vector<int> victims(OPERATIONS);
+    for (int &victim : victims) victim = rng() % N;
+
+    double intrusiveRandom = millisecondsFor([&]() {
+        for (int victim : victims) {
+            intrusive.erase(arena[victim]);
+            intrusive.pushBack(arena[victim]);
+        }
+        listSink = intrusive.front().id;
+    });
+
+    // std::list needs an iterator per object to erase in O(1)
+    vector<list<int>::iterator> positions;
+    positions.reserve(N);
+    standard.clear();
+    for (int i = 0; i < N; i++) positions.push_back(standard.insert(standard.end(), i));
+    double standardRandom = millisecondsFor([&]() {
+        for (int victim : victims) {
+            standard.erase(positions[victim]);
+            positions[victim] = standard.insert(standard.end(), victim);
+        }
+        listSink = standard.front();
+    });
+
+    // LinkedList can only find the object by searching, so it runs far fewer operations
+    const int LINKED_OPERATIONS = 2000;
+    double linkedRandom = millisecondsFor([&]() {
+        for (int i = 0; i < LINKED_OPERATIONS; i++) {
+            node* found = linked.deleteNode(victims[i]);
+            linked.addAtEnd(found);
+        }
+        listSink = linked.head->data;
+    });
+    intrusive.clear();
+
+    cout << "\nChurn on a list of " << N << " objects (ns per remove + insert)" << endl;
+    cout << "                  front to back    random to back" << endl;
+    cout << "IntrusiveList:    " << intrusiveFifo * 1e6 / OPERATIONS << "    " << intrusiveRandom * 1e6 / OPERATIONS << endl;
+    cout << "std::list:        " << standardFifo * 1e6 / OPERATIONS << "    " << standardRandom * 1e6 / OPERATIONS << endl;
+    cout << "LinkedList:       " << linkedFifo * 1e6 / OPERATIONS << "    " << linkedRandom * 1e6 / LINKED_OPERATIONS
+         << " (search by value)" << endl;
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include <iostream>
+#include <chrono>
+using namespace std;
+
+/*
+    Linked List Operations.cpp keeps a `tail` pointer in LinkedList, so `addAtEnd` links the
+    new node after the tail instead of walking the list to find the last node. This program
+    includes that file and checks the claim: it appends 10,000,000 nodes and times each
+    decade of growth (up to 1,000, 10,000, ... nodes).
+
+    With the tail pointer the time per append stays flat as the list grows. Without it every
+    append would walk the whole list, so the time per append would grow with the length and
+    the whole run would take O(n²): about 5 * 10^13 node visits for 10M nodes.
+
+    Time Complexity:
+        - addAtEnd: O(1) per append, O(n) for the run.
+
+    Space Complexity:
+        - O(n) for the nodes.
+*/
+
+// LinkedList and node, without that program's main
+#define WITHOUT_MAIN
+#include "../2 Linked List Operations/Linked List Operations.cpp"
+#undef WITHOUT_MAIN
+
+int main() {
+    cout << "Appending 10,000,000 nodes with addAtEnd:" << endl;
+    LinkedList<> log;
+    const int TOTAL = 10000000;
+    int checkpoint = 1000;
+    int appended = 0;
+    while (appended < TOTAL) {
+        int batch = checkpoint - appended;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < batch; i++) {
+            log.addAtEnd(new node(appended + i));
+        }
+        auto end = chrono::steady_clock::now();
+        appended = checkpoint;
+        double nanoseconds = chrono::duration<double, nano>(end - start).count();
+        cout << "  up to " << appended << " nodes: " << nanoseconds / batch << " ns per append" << endl;
+        checkpoint *= 10;
+    }
+    cout << "  countNodes: " << log.countNodes() << endl;
+
+    // The destructor frees the nodes
+    return 0;
+}
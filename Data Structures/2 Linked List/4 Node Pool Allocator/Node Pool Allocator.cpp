@@ -0,0 +1,406 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include "../../Heap Allocator.h"
+using namespace std;
+
+/*
+    The LinkedList, Stack, Queue and Binary Search Tree programs call `new` for every node
+    they add and `delete` for every node they remove. The general-purpose allocator behind
+    `new` has to handle any size from any thread, so each call costs tens of nanoseconds, and
+    consecutive nodes end up scattered across the heap between unrelated allocations.
+    Traversing such a list jumps between cache lines (and pages) at every `next`.
+
+    A node pool allocator exploits the fact that all nodes of a container have the same size:
+        - Memory is requested in large chunks (here 4096 nodes at a time) and handed out one
+          slot at a time with a bump pointer, so nodes allocated together sit next to each
+          other in memory.
+        - A freed node is pushed onto a free list that is stored inside the freed slots
+          themselves; the next allocation pops it. Both operations are a few instructions.
+        - Bulk release: `releaseAll()` returns every chunk at once, so a whole tree or list is
+          freed in O(number of chunks) instead of visiting every node.
+
+    For multi-threaded programs, `SharedNodePool` puts a mutex around one pool and gives each
+    thread a small thread-local cache of free slots. Most allocations and releases only touch
+    the cache; the mutex is taken once per batch of 128 slots.
+
+    Allocator parameter:
+        LinkedList, Stack, Queue and the BST functions take an `Allocator` template parameter
+        in their own files, and this program includes those files and benchmarks them. An
+        allocator is a small copyable handle offering `create(args...)` and `destroy(node)`:
+            - HeapAllocator (each container's default): plain `new` / `delete`.
+            - PoolAllocator: a handle to a single-threaded NodePool.
+            - SharedPoolAllocator: thread-safe pool with thread-local caches.
+
+    Time Complexity:
+        - create / destroy: O(1); a new chunk is allocated once every 4096 nodes.
+        - releaseAll: O(number of chunks).
+
+    Space Complexity:
+        - O(n) nodes, rounded up to whole chunks. Memory freed to a pool is reused by the pool
+          but not returned to the system until releaseAll or the pool is destroyed.
+
+    Cons:
+        - Only for one node size per pool.
+        - releaseAll does not run destructors, so it is only allowed for trivially destructible
+          nodes (like the ones in this repo).
+*/
+
+/*
+    Allocators
+*/
+
+// Single-threaded pool of equally sized slots with an intrusive free list
+template <typename T, size_t SlotsPerChunk = 4096>
+class NodePool {
+private:
+    union Slot {
+        Slot *nextFree; // Valid while the slot is free
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Chunk {
+        Chunk *next;
+        Slot slots[SlotsPerChunk];
+    };
+
+    Chunk *chunks = nullptr;     // Every chunk, newest first
+    Slot *freeList = nullptr;    // Released slots
+    size_t nextUnused = SlotsPerChunk; // Bump pointer into the newest chunk
+    size_t chunkCount = 0;
+
+public:
+    NodePool() = default;
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    ~NodePool() {
+        while (chunks) {
+            Chunk *next = chunks->next;
+            delete chunks;
+            chunks = next;
+        }
+    }
+
+    // Returns uninitialized storage for one T
+    T *allocate() {
+        if (freeList) {
+            Slot *slot = freeList;
+            freeList = slot->nextFree;
+            return reinterpret_cast<T *>(slot->storage);
+        }
+        if (nextUnused == SlotsPerChunk) {
+            Chunk *chunk = new Chunk;
+            chunk->next = chunks;
+            chunks = chunk;
+            nextUnused = 0;
+            chunkCount++;
+        }
+        return reinterpret_cast<T *>(chunks->slots[nextUnused++].storage);
+    }
+
+    // Returns storage obtained from allocate() to the free list
+    void deallocate(T *pointer) {
+        Slot *slot = reinterpret_cast<Slot *>(pointer);
+        slot->nextFree = freeList;
+        freeList = slot;
+    }
+
+    template <typename... Args>
+    T *create(Args &&... args) { return new (allocate()) T(std::forward<Args>(args)...); }
+
+    void destroy(T *node) {
+        node->~T();
+        deallocate(node);
+    }
+
+    // Frees every node at once, without visiting them
+    void releaseAll() {
+        static_assert(is_trivially_destructible<T>::value, "releaseAll skips destructors.");
+        while (chunks) {
+            Chunk *next = chunks->next;
+            delete chunks;
+            chunks = next;
+        }
+        freeList = nullptr;
+        nextUnused = SlotsPerChunk;
+        chunkCount = 0;
+    }
+
+    size_t bytesReserved() const { return chunkCount * sizeof(Chunk); }
+};
+
+// Allocator handle over a NodePool; copies share the pool, so containers can hold it by value
+template <typename T>
+class PoolAllocator {
+private:
+    NodePool<T> *pool;
+
+public:
+    PoolAllocator(NodePool<T> &pool) : pool(&pool) {}
+
+    template <typename... Args>
+    T *create(Args &&... args) { return pool->create(std::forward<Args>(args)...); }
+
+    void destroy(T *node) { pool->destroy(node); }
+};
+
+// Thread-safe pool shared by all threads, one per node type, with per-thread caches
+template <typename T>
+class SharedNodePool {
+private:
+    static const size_t BATCH = 128;      // Slots moved between a cache and the pool at once
+    static const size_t CACHE_LIMIT = 256; // Cached slots above this are returned
+
+    mutex lock;
+    NodePool<T> pool;
+
+    // Free slots owned by one thread; returned to the pool when the thread exits
+    struct ThreadCache {
+        vector<T *> slots;
+        ~ThreadCache() { SharedNodePool::instance().returnSlots(slots, slots.size()); }
+    };
+
+    static ThreadCache &cache() {
+        thread_local ThreadCache threadCache;
+        return threadCache;
+    }
+
+    void returnSlots(vector<T *> &slots, size_t n) {
+        lock_guard<mutex> guard(lock);
+        for (size_t i = 0; i < n; i++) {
+            pool.deallocate(slots.back());
+            slots.pop_back();
+        }
+    }
+
+    SharedNodePool() = default;
+
+public:
+    static SharedNodePool &instance() {
+        static SharedNodePool shared;
+        return shared;
+    }
+
+    T *allocate() {
+        vector<T *> &slots = cache().slots;
+        if (slots.empty()) {
+            lock_guard<mutex> guard(lock);
+            for (size_t i = 0; i < BATCH; i++) slots.push_back(pool.allocate());
+        }
+        T *slot = slots.back();
+        slots.pop_back();
+        return slot;
+    }
+
+    void deallocate(T *pointer) {
+        vector<T *> &slots = cache().slots;
+        slots.push_back(pointer);
+        if (slots.size() > CACHE_LIMIT) returnSlots(slots, BATCH);
+    }
+};
+
+// Allocator interface over the shared pool
+template <typename T>
+class SharedPoolAllocator {
+public:
+    template <typename... Args>
+    T *create(Args &&... args) { return new (SharedNodePool<T>::instance().allocate()) T(std::forward<Args>(args)...); }
+
+    void destroy(T *node) {
+        node->~T();
+        SharedNodePool<T>::instance().deallocate(node);
+    }
+};
+
+/*
+    The containers from their own folders. Every one of those files is a complete program with
+    its own Node class, so each is included in a namespace of its own, without its main. The
+    standard headers they use, and Heap Allocator.h, are all included at the top of this file,
+    so none of them is first opened inside one of these namespaces; the containers all share
+    the global HeapAllocator.
+*/
+
+#define WITHOUT_MAIN
+namespace linkedList {
+#include "../2 Linked List Operations/Linked List Operations.cpp"
+}
+namespace linkedStack {
+#include "../../3 Stack/1 Stack/Stack.cpp"
+}
+namespace linkedQueue {
+#include "../../4 Queue/1 Queue/Queue.cpp"
+}
+namespace searchTree {
+#include "../../6 Binary Tree/2 Binary Search Tree/Binary Search Tree.cpp"
+}
+#undef WITHOUT_MAIN
+
+typedef linkedList::node ListNode;
+typedef linkedStack::Node StackNode;
+typedef linkedQueue::Node QueueNode;
+typedef searchTree::Node TreeNode;
+
+// In-order sum, to measure traversal
+long long sumTree(TreeNode *node) {
+    if (!node) return 0;
+    return sumTree(node->left) + node->data + sumTree(node->right);
+}
+
+/*
+    Benchmarks
+*/
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+volatile long long poolSink; // Keeps benchmarked results alive
+
+// Pushes and pops `rounds` times `n` values
+template <typename Allocator>
+void stackWorkload(Allocator allocator, int n, int rounds) {
+    linkedStack::Stack<Allocator> stack(allocator);
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < n; i++) stack.push(i);
+        for (int i = 0; i < n; i++) stack.pop();
+    }
+}
+
+// Keeps the queue about `window` long while `n` values pass through it
+template <typename Allocator>
+void queueWorkload(Allocator allocator, int n, int window) {
+    linkedQueue::Queue<Allocator> queue(allocator);
+    for (int i = 0; i < n; i++) {
+        queue.enqueue(i);
+        if (i >= window) queue.dequeue();
+    }
+}
+
+// Builds a list of n nodes while unrelated allocations of random sizes come and go, as in a
+// long-running program, then returns the traversal time
+template <typename Allocator>
+double listTraversalAfterChurn(Allocator allocator, int n) {
+    mt19937 rng(17);
+    vector<char *> unrelated;
+    linkedList::LinkedList<Allocator> list(allocator);
+    for (int i = 0; i < n; i++) {
+        list.addAtFront(i);
+        unrelated.push_back(new char[16 + rng() % 112]);
+        if (rng() % 2 && !unrelated.empty()) {
+            size_t victim = rng() % unrelated.size();
+            delete[] unrelated[victim];
+            unrelated[victim] = unrelated.back();
+            unrelated.pop_back();
+        }
+    }
+
+    double time = millisecondsFor([&]() {
+        for (int r = 0; r < 10; r++) {
+            long long total = 0;
+            for (ListNode *ptr = list.head; ptr; ptr = ptr->next) total += ptr->data;
+            poolSink = total;
+        }
+    });
+    for (char *block : unrelated) delete[] block;
+    return time;
+}
+
+int main() {
+
+    // The real containers using pools
+    NodePool<ListNode> listPool;
+    NodePool<StackNode> stackPool;
+    NodePool<QueueNode> queuePool;
+    {
+        linkedList::LinkedList<PoolAllocator<ListNode>> list(listPool);
+        list.addAtFront(12);
+        list.addAtFront(8);
+        list.addAtFront(5);
+        list.allocator.destroy(list.deleteNode(8));
+        cout << "Pooled list: ";
+        list.printList();
+
+        linkedStack::Stack<PoolAllocator<StackNode>> stack(stackPool);
+        stack.push(67);
+        stack.push(42);
+        cout << "Pooled stack top: " << stack.top->data << endl;
+    }
+
+    NodePool<TreeNode> treePool;
+    PoolAllocator<TreeNode> treeAllocator(treePool);
+    TreeNode *root = nullptr;
+    for (int val : {5, 3, 8, 1, 4, 7, 9, 0, 2, 6, 10}) root = searchTree::insert(root, val, treeAllocator);
+    cout << "Pooled BST in-order sum: " << sumTree(root) << endl;
+    treePool.releaseAll(); // Frees the whole tree without visiting its nodes
+    root = nullptr;
+
+    HeapAllocator<StackNode> heapStackNodes;
+    HeapAllocator<QueueNode> heapQueueNodes;
+    SharedPoolAllocator<StackNode> sharedStackNodes;
+
+    // Insert/delete throughput
+    const int N = 1000000;
+    cout << "\nStack: push then pop " << N << " values, 10 rounds" << endl;
+    cout << "  new/delete:  " << millisecondsFor([&]() { stackWorkload(heapStackNodes, N, 10); }) << " ms" << endl;
+    cout << "  NodePool:    " << millisecondsFor([&]() { stackWorkload(PoolAllocator<StackNode>(stackPool), N, 10); }) << " ms" << endl;
+    cout << "  SharedPool:  " << millisecondsFor([&]() { stackWorkload(sharedStackNodes, N, 10); }) << " ms" << endl;
+
+    cout << "\nQueue: " << 10 * N << " values through a window of 1000" << endl;
+    cout << "  new/delete:  " << millisecondsFor([&]() { queueWorkload(heapQueueNodes, 10 * N, 1000); }) << " ms" << endl;
+    cout << "  NodePool:    " << millisecondsFor([&]() { queueWorkload(PoolAllocator<QueueNode>(queuePool), 10 * N, 1000); }) << " ms" << endl;
+
+    // BST: insertion, traversal, and freeing the whole tree
+    mt19937 rng(23);
+    vector<int> keys(N);
+    for (int &key : keys) key = rng();
+
+    double heapInsert = millisecondsFor([&]() { for (int key : keys) root = searchTree::insert(root, key); });
+    double heapTraverse = millisecondsFor([&]() { poolSink = sumTree(root); });
+    double heapFree = millisecondsFor([&]() { searchTree::deleteTree(root); });
+    root = nullptr;
+
+    double poolInsert = millisecondsFor([&]() { for (int key : keys) root = searchTree::insert(root, key, treeAllocator); });
+    double poolTraverse = millisecondsFor([&]() { poolSink = sumTree(root); });
+    double poolFree = millisecondsFor([&]() { treePool.releaseAll(); });
+    root = nullptr;
+
+    cout << "\nBST with " << N << " random keys (insert / traverse / free)" << endl;
+    cout << "  new/delete:  " << heapInsert << " / " << heapTraverse << " / " << heapFree << " ms" << endl;
+    cout << "  NodePool:    " << poolInsert << " / " << poolTraverse << " / " << poolFree << " ms (releaseAll)" << endl;
+
+    // Traversal of a list built while the heap is busy with other allocations
+    cout << "\nList traversal (10 passes over " << N << " nodes built amid unrelated allocations)" << endl;
+    cout << "  new/delete:  " << listTraversalAfterChurn(HeapAllocator<ListNode>(), N) << " ms" << endl;
+    cout << "  NodePool:    " << listTraversalAfterChurn(PoolAllocator<ListNode>(listPool), N) << " ms" << endl;
+
+    // Several threads pushing and popping on their own stacks through the shared pool
+    const int THREADS = 4;
+    auto threaded = [&](auto allocator) {
+        return millisecondsFor([&]() {
+            vector<thread> workers;
+            for (int t = 0; t < THREADS; t++) {
+                workers.emplace_back([&]() { stackWorkload(allocator, N / THREADS, 10); });
+            }
+            for (thread &worker : workers) worker.join();
+        });
+    };
+    cout << "\n" << THREADS << " threads, stack push/pop of " << N / THREADS << " values each, 10 rounds"
+         << " (" << thread::hardware_concurrency() << " hardware threads available)" << endl;
+    cout << "  new/delete:  " << threaded(heapStackNodes) << " ms" << endl;
+    cout << "  SharedPool:  " << threaded(sharedStackNodes) << " ms" << endl;
+
+    return 0;
+}
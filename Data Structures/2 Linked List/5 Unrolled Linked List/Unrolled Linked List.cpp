@@ -0,0 +1,325 @@
+#include <iostream>
+#include <list>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <new>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+using namespace std;
+
+/*
+    In the LinkedList of Linked List Operations.cpp every `int` lives in its own node, so
+    search, countNodes and printList follow one pointer per element. Each hop can be a cache
+    miss, and a node (4 bytes of data, 8 bytes of pointer, padding and the allocator's own
+    header) takes about 32 bytes of heap for 4 bytes of data.
+
+    An unrolled linked list stores a small array of elements in each node (a block). Here a
+    block is exactly one 64-byte cache line:
+
+        [next | count | 13 ints] -> [next | count | 13 ints] -> ...
+
+    A traversal loads one cache line and then reads up to 13 consecutive elements from it,
+    which the CPU can prefetch and the compiler can vectorize. There are 13 times fewer
+    pointers to follow and allocations to make.
+
+    Operations (the same as LinkedList):
+        - addAtFront / addAtEnd: insert into the first / last block, or start a new block when
+          it is full. Inserting at the front shifts at most 12 elements of one block.
+        - search: scans blocks and returns a pointer to the element.
+        - deleteNode: removes the first element with the value by shifting the rest of its
+          block. When a block becomes less than half full it is merged with the next block if
+          both fit in one, so blocks stay reasonably full.
+        - deleteFromEnd: removes the last element of the tail block; only when the tail block
+          becomes empty is the list walked to find the new tail block.
+
+    Time Complexity (B = elements per block = 13):
+        - addAtFront, addAtEnd: O(B) worst case, O(1) for addAtEnd.
+        - search, deleteNode, printList: O(n), but with n / B pointer hops.
+        - deleteFromEnd: O(1), or O(n / B) when the tail block is emptied.
+        - countNodes: O(1) (a counter is kept).
+
+    Space Complexity:
+        - O(n): between 64 / 13 ≈ 5 and (with half-full blocks) about 10 bytes per element,
+          plus the allocator's overhead per block, against about 32 bytes per element for one
+          node per element.
+
+    Cons:
+        - Inserting or deleting shifts elements inside a block, and pointers to elements are
+          invalidated by those shifts.
+*/
+
+class UnrolledLinkedList {
+private:
+    static const int BLOCK_BYTES = 64; // One cache line
+
+    static const int CAPACITY = (BLOCK_BYTES - sizeof(void *) - sizeof(int)) / sizeof(int);
+
+    struct alignas(BLOCK_BYTES) Block {
+        Block *next;
+        int count;
+        int values[CAPACITY];
+
+        Block() : next(nullptr), count(0) {}
+    };
+
+    Block *head;
+    Block *tail;
+    int size;
+
+    // Merges `block` with the following block when they fit together
+    void mergeWithNext(Block *block) {
+        Block *next = block->next;
+        if (!next || block->count + next->count > CAPACITY) return;
+        for (int i = 0; i < next->count; i++) block->values[block->count + i] = next->values[i];
+        block->count += next->count;
+        block->next = next->next;
+        if (next == tail) tail = block;
+        delete next;
+    }
+
+    // Unlinks an empty block; `prev` is the block before it or nullptr
+    void removeBlock(Block *block, Block *prev) {
+        if (prev) prev->next = block->next;
+        else head = block->next;
+        if (block == tail) tail = prev;
+        delete block;
+    }
+
+public:
+    // Constructor to initialize the list as empty
+    UnrolledLinkedList() {
+        head = tail = nullptr;
+        size = 0;
+    }
+
+    UnrolledLinkedList(const UnrolledLinkedList &) = delete;
+    UnrolledLinkedList &operator=(const UnrolledLinkedList &) = delete;
+
+    static int blockCapacity() { return CAPACITY; }
+
+    // Function to check whether the list is empty
+    bool isEmpty() {
+        return size == 0;
+    }
+
+    // Function to add an element at the front of the list
+    void addAtFront(int value) {
+        if (!head || head->count == CAPACITY) {
+            Block *block = new Block();
+            block->next = head;
+            head = block;
+            if (!tail) tail = block;
+        }
+        for (int i = head->count; i > 0; i--) head->values[i] = head->values[i - 1]; // Make room at index 0
+        head->values[0] = value;
+        head->count++;
+        size++;
+    }
+
+    // Function to add an element at the end of the list
+    void addAtEnd(int value) {
+        if (!tail || tail->count == CAPACITY) {
+            Block *block = new Block();
+            if (tail) tail->next = block;
+            else head = block;
+            tail = block;
+        }
+        tail->values[tail->count++] = value;
+        size++;
+    }
+
+    // Function to search for an element; returns a pointer to it or nullptr
+    int *search(int value) {
+        for (Block *block = head; block; block = block->next) {
+            for (int i = 0; i < block->count; i++) {
+                if (block->values[i] == value) return &block->values[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Function to delete the first element with the value; returns whether it was found
+    bool deleteNode(int value) {
+        Block *prev = nullptr;
+        for (Block *block = head; block; prev = block, block = block->next) {
+            for (int i = 0; i < block->count; i++) {
+                if (block->values[i] != value) continue;
+
+                for (int j = i; j < block->count - 1; j++) block->values[j] = block->values[j + 1];
+                block->count--;
+                size--;
+                if (block->count == 0) removeBlock(block, prev);
+                else if (block->count < CAPACITY / 2) mergeWithNext(block);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Function to delete the last element; returns false when the list is empty
+    bool deleteFromEnd(int &value) {
+        if (isEmpty()) return false;
+        value = tail->values[--tail->count];
+        size--;
+        if (tail->count == 0) {
+            // The previous block can only be found by walking from the head
+            Block *prev = nullptr;
+            if (head != tail) {
+                prev = head;
+                while (prev->next != tail) prev = prev->next;
+            }
+            removeBlock(tail, prev);
+        }
+        return true;
+    }
+
+    // Function to count the total number of elements
+    int countNodes() {
+        return size;
+    }
+
+    // Sum of all elements, used to measure traversal
+    long long sum() {
+        long long total = 0;
+        for (Block *block = head; block; block = block->next) {
+            for (int i = 0; i < block->count; i++) total += block->values[i];
+        }
+        return total;
+    }
+
+    // Function to print the list, one block per bracket
+    void printList() {
+        if (isEmpty()) {
+            cout << "List is empty!" << endl;
+            return;
+        }
+        for (Block *block = head; block; block = block->next) {
+            cout << "[";
+            for (int i = 0; i < block->count; i++) cout << (i ? " " : "") << block->values[i];
+            cout << "] -> ";
+        }
+        cout << "NULL" << endl;
+    }
+
+    // Destructor to clean up memory
+    ~UnrolledLinkedList() {
+        while (head) {
+            Block *next = head->next;
+            delete head;
+            head = next;
+        }
+        tail = nullptr;
+        size = 0;
+    }
+};
+
+/*
+    Benchmark against LinkedList and std::list
+*/
+
+// LinkedList from Linked List Operations.cpp, without that program's main
+#define WITHOUT_MAIN
+#include "../2 Linked List Operations/Linked List Operations.cpp"
+#undef WITHOUT_MAIN
+
+// Sum of all elements of a LinkedList, to measure traversal
+long long sumList(const LinkedList<> &list) {
+    long long total = 0;
+    for (node *ptr = list.head; ptr; ptr = ptr->next) total += ptr->data;
+    return total;
+}
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+// Heap bytes currently in use, or -1 where the C library does not report it
+long long heapBytesInUse() {
+#ifdef __GLIBC__
+    return (long long) mallinfo2().uordblks;
+#else
+    return -1;
+#endif
+}
+
+volatile long long listSink; // Keeps benchmarked results alive
+
+int main() {
+    UnrolledLinkedList L;
+
+    for (int i = 1; i <= 20; i++) L.addAtEnd(i * 10);
+    L.addAtFront(5);
+    cout << "Blocks of " << UnrolledLinkedList::blockCapacity() << " ints:" << endl;
+    L.printList();
+
+    cout << "Search 70: " << (L.search(70) ? "found" : "not found") << endl;
+    L.deleteNode(70);
+    L.deleteNode(80);
+    L.deleteNode(90);
+    int last = 0;
+    L.deleteFromEnd(last);
+    cout << "After deleting 70, 80, 90 and the last element (" << last << "):" << endl;
+    L.printList();
+    cout << "Total elements: " << L.countNodes() << endl;
+
+    // Benchmark
+    const int N = 2000000;
+    const int SEARCHES = 200;
+    mt19937 rng(29);
+    vector<int> targets(SEARCHES);
+    for (int &target : targets) target = rng() % N;
+
+    long long before = heapBytesInUse();
+    LinkedList<> linked;
+    for (int i = 0; i < N; i++) linked.addAtEnd(i);
+    long long linkedBytes = heapBytesInUse() - before;
+
+    before = heapBytesInUse();
+    list<int> standard;
+    for (int i = 0; i < N; i++) standard.push_back(i);
+    long long standardBytes = heapBytesInUse() - before;
+
+    before = heapBytesInUse();
+    UnrolledLinkedList unrolled;
+    for (int i = 0; i < N; i++) unrolled.addAtEnd(i);
+    long long unrolledBytes = heapBytesInUse() - before;
+
+    double linkedTraverse = millisecondsFor([&]() { for (int r = 0; r < 10; r++) listSink = sumList(linked); });
+    double standardTraverse = millisecondsFor([&]() {
+        for (int r = 0; r < 10; r++) {
+            long long total = 0;
+            for (int value : standard) total += value;
+            listSink = total;
+        }
+    });
+    double unrolledTraverse = millisecondsFor([&]() { for (int r = 0; r < 10; r++) listSink = unrolled.sum(); });
+
+    double linkedSearch = millisecondsFor([&]() { for (int t : targets) listSink = linked.search(t) != nullptr; });
+    double standardSearch = millisecondsFor([&]() {
+        for (int t : targets) {
+            for (int value : standard) {
+                if (value == t) {
+                    listSink = value;
+                    break;
+                }
+            }
+        }
+    });
+    double unrolledSearch = millisecondsFor([&]() { for (int t : targets) listSink = unrolled.search(t) != nullptr; });
+
+    cout << "\nBenchmark with " << N << " elements (traversal: 10 passes, search: " << SEARCHES << " values)" << endl;
+    cout << "                      traversal      search    bytes/element" << endl;
+    cout << "LinkedList:           " << linkedTraverse << " ms   " << linkedSearch << " ms   " << (double) linkedBytes / N << endl;
+    cout << "std::list:            " << standardTraverse << " ms   " << standardSearch << " ms   " << (double) standardBytes / N << endl;
+    cout << "UnrolledLinkedList:   " << unrolledTraverse << " ms   " << unrolledSearch << " ms   " << (double) unrolledBytes / N << endl;
+    if (before < 0) cout << "(bytes/element not available: heap statistics need glibc)" << endl;
+
+    return 0;
+}
@@ -0,0 +1,410 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+using namespace std;
+
+/*
+    The DoublyNode of Linked List and Types.cpp stores a 4-byte `int` next to two 8-byte
+    pointers, so a node is 24 bytes (with padding) for 4 bytes of data. This program shows two
+    ways to keep doubly linked, bidirectional lists while spending less memory on links.
+
+    1. XOR-linked list:
+        Each node stores a single link field: the XOR of the addresses of its previous and
+        next nodes (prev ^ next). Walking forward, the address of the previous node is known,
+        so next = link ^ prev; walking backward works the same way from the other end. A node
+        is 16 bytes instead of 24.
+            - Positions are (previous, current) pairs (`XorCursor`), because a node alone does
+              not tell where its neighbors are.
+            - insertAfter and erase at a cursor are O(1): only the links of the two neighbors
+              change (XOR the old address out and the new one in).
+            - With a general-purpose allocator both 16 and 24 bytes are rounded up to the same
+              block size (32 bytes with glibc), so the saving appears when nodes come from a
+              pool or arena (see Node Pool Allocator.cpp).
+            - Pointers hidden in XOR values are invisible to debuggers and leak checkers.
+
+    2. Index-linked list:
+        Nodes live in one contiguous vector, and links are 32-bit indices into it instead of
+        64-bit pointers. A node is 12 bytes (data, prev, next), with no per-node allocation.
+            - Removed slots go to a free list and are reused by later inserts.
+            - Because links are indices, the whole array can be moved (vector growth, saving
+              to a file, copying to another process) without fixing any link.
+            - compact() rewrites the nodes in list order, so traversal becomes a sequential
+              scan of the array.
+            - Limited to about 4 billion nodes.
+
+    Time Complexity (both lists):
+        - pushFront, pushBack, insertAfter, erase at a known position: O(1).
+        - Traversal forward or backward: O(n).
+        - compact (index list): O(n).
+
+    Space Complexity:
+        - O(n): 16 bytes per node (XOR) or 12 bytes per node (index), against 24 for DoublyNode.
+*/
+
+/*
+    XOR-linked list
+*/
+
+struct XorNode {
+    int data;
+    uintptr_t link; // Address of previous node XOR address of next node
+};
+
+// Position in an XOR list: the node and the one before it in the walking direction
+struct XorCursor {
+    XorNode *previous;
+    XorNode *current;
+};
+
+class XorLinkedList {
+private:
+    XorNode *head;
+    XorNode *tail;
+    int size;
+
+    static XorNode *neighbor(XorNode *node, XorNode *other) {
+        return reinterpret_cast<XorNode *>(node->link ^ reinterpret_cast<uintptr_t>(other));
+    }
+
+    static uintptr_t address(XorNode *node) { return reinterpret_cast<uintptr_t>(node); }
+
+public:
+    XorLinkedList() {
+        head = tail = nullptr;
+        size = 0;
+    }
+
+    XorLinkedList(const XorLinkedList &) = delete;
+    XorLinkedList &operator=(const XorLinkedList &) = delete;
+
+    ~XorLinkedList() {
+        XorNode *previous = nullptr;
+        XorNode *current = head;
+        while (current) {
+            XorNode *next = neighbor(current, previous);
+            delete previous;
+            previous = current;
+            current = next;
+        }
+        delete previous;
+    }
+
+    bool isEmpty() const { return size == 0; }
+    int countNodes() const { return size; }
+
+    // Cursor at the first node, walking forward
+    XorCursor begin() const { return {nullptr, head}; }
+
+    // Cursor at the last node, walking backward
+    XorCursor rbegin() const { return {nullptr, tail}; }
+
+    // Moves a cursor one node in its walking direction
+    static XorCursor advance(XorCursor cursor) {
+        return {cursor.current, neighbor(cursor.current, cursor.previous)};
+    }
+
+    void pushFront(int value) {
+        XorNode *node = new XorNode{value, address(head)};
+        if (head) head->link ^= address(node); // head's previous was nullptr, now `node`
+        else tail = node;
+        head = node;
+        size++;
+    }
+
+    void pushBack(int value) {
+        XorNode *node = new XorNode{value, address(tail)};
+        if (tail) tail->link ^= address(node);
+        else head = node;
+        tail = node;
+        size++;
+    }
+
+    // Inserts after the cursor's node (in the cursor's walking direction); returns a cursor to the new node.
+    // A one-node list has no direction, so the new node goes after it in forward order.
+    XorCursor insertAfter(XorCursor cursor, int value) {
+        XorNode *current = cursor.current;
+        XorNode *next = neighbor(current, cursor.previous);
+        XorNode *node = new XorNode{value, address(current) ^ address(next)};
+
+        current->link ^= address(next) ^ address(node);
+        if (next) next->link ^= address(current) ^ address(node);
+        else if (current == tail) tail = node;
+        else head = node; // Walking backward past the head
+        size++;
+        return {current, node};
+    }
+
+    // Removes the cursor's node; returns a cursor to the node that followed it
+    XorCursor erase(XorCursor cursor) {
+        XorNode *previous = cursor.previous;
+        XorNode *current = cursor.current;
+        XorNode *next = neighbor(current, previous);
+
+        if (previous) previous->link ^= address(current) ^ address(next);
+        if (next) next->link ^= address(current) ^ address(previous);
+        if (current == head) head = previous ? previous : next;
+        if (current == tail) tail = previous ? previous : next;
+        delete current;
+        size--;
+        return {previous, next};
+    }
+
+    void printList() const {
+        cout << "NULL <-> ";
+        for (XorCursor c = begin(); c.current; c = advance(c)) cout << c.current->data << " <-> ";
+        cout << "NULL" << endl;
+    }
+};
+
+/*
+    Index-linked list
+*/
+
+class IndexLinkedList {
+public:
+    static const uint32_t NIL = UINT32_MAX;
+
+private:
+    struct Slot {
+        int data;
+        uint32_t prev;
+        uint32_t next; // Also links free slots together
+    };
+
+    vector<Slot> slots;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t freeList;
+    int size;
+
+    uint32_t allocateSlot(int value, uint32_t prev, uint32_t next) {
+        uint32_t index;
+        if (freeList != NIL) {
+            index = freeList;
+            freeList = slots[index].next;
+            slots[index] = {value, prev, next};
+        } else {
+            index = (uint32_t) slots.size();
+            slots.push_back({value, prev, next});
+        }
+        return index;
+    }
+
+public:
+    IndexLinkedList() {
+        head = tail = freeList = NIL;
+        size = 0;
+    }
+
+    bool isEmpty() const { return size == 0; }
+    int countNodes() const { return size; }
+
+    uint32_t first() const { return head; }
+    uint32_t last() const { return tail; }
+    uint32_t next(uint32_t index) const { return slots[index].next; }
+    uint32_t previous(uint32_t index) const { return slots[index].prev; }
+    int &value(uint32_t index) { return slots[index].data; }
+
+    void reserve(size_t n) { slots.reserve(n); }
+
+    uint32_t pushFront(int value) {
+        uint32_t index = allocateSlot(value, NIL, head);
+        if (head != NIL) slots[head].prev = index;
+        else tail = index;
+        head = index;
+        size++;
+        return index;
+    }
+
+    uint32_t pushBack(int value) {
+        uint32_t index = allocateSlot(value, tail, NIL);
+        if (tail != NIL) slots[tail].next = index;
+        else head = index;
+        tail = index;
+        size++;
+        return index;
+    }
+
+    // Inserts after the node at `position`; returns the new node's index
+    uint32_t insertAfter(uint32_t position, int value) {
+        uint32_t following = slots[position].next;
+        uint32_t index = allocateSlot(value, position, following);
+        slots[position].next = index;
+        if (following != NIL) slots[following].prev = index;
+        else tail = index;
+        size++;
+        return index;
+    }
+
+    // Removes the node at `position`; returns the index of the node that followed it
+    uint32_t erase(uint32_t position) {
+        uint32_t before = slots[position].prev;
+        uint32_t after = slots[position].next;
+        if (before != NIL) slots[before].next = after;
+        else head = after;
+        if (after != NIL) slots[after].prev = before;
+        else tail = before;
+
+        slots[position].next = freeList;
+        freeList = position;
+        size--;
+        return after;
+    }
+
+    // Rewrites the nodes in list order with no free slots; every index changes
+    void compact() {
+        vector<Slot> ordered;
+        ordered.reserve(size);
+        for (uint32_t i = head; i != NIL; i = slots[i].next) {
+            uint32_t position = (uint32_t) ordered.size();
+            ordered.push_back({slots[i].data, position == 0 ? NIL : position - 1, NIL});
+            if (position > 0) ordered[position - 1].next = position;
+        }
+        slots.swap(ordered);
+        head = size > 0 ? 0 : NIL;
+        tail = size > 0 ? (uint32_t) size - 1 : NIL;
+        freeList = NIL;
+    }
+
+    size_t bytesReserved() const { return slots.capacity() * sizeof(Slot); }
+    static size_t nodeBytes() { return sizeof(Slot); }
+
+    void printList() const {
+        cout << "NULL <-> ";
+        for (uint32_t i = head; i != NIL; i = slots[i].next) cout << slots[i].data << " <-> ";
+        cout << "NULL" << endl;
+    }
+};
+
+/*
+    Benchmark against DoublyNode
+*/
+
+// DoublyNode from Linked List and Types.cpp
+struct DoublyNode {
+    int data;
+    DoublyNode *prev;
+    DoublyNode *next;
+};
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+// Heap bytes currently in use, or -1 where the C library does not report it
+long long heapBytesInUse() {
+#ifdef __GLIBC__
+    return (long long) mallinfo2().uordblks;
+#else
+    return -1;
+#endif
+}
+
+volatile long long compactSink; // Keeps benchmarked results alive
+
+int main() {
+
+    // XOR list
+    XorLinkedList xorList;
+    for (int value : {20, 30, 50}) xorList.pushBack(value);
+    xorList.pushFront(10);
+    XorCursor c = XorLinkedList::advance(XorLinkedList::advance(xorList.begin())); // At 30
+    xorList.insertAfter(c, 40);
+    cout << "XOR list:              ";
+    xorList.printList();
+    cout << "XOR list backward:     ";
+    for (XorCursor r = xorList.rbegin(); r.current; r = XorLinkedList::advance(r)) cout << r.current->data << " ";
+    cout << endl;
+    xorList.erase(XorLinkedList::advance(xorList.begin())); // Erase 20
+    cout << "After erasing 20:      ";
+    xorList.printList();
+
+    // Index list
+    IndexLinkedList indexList;
+    uint32_t ten = indexList.pushBack(10);
+    uint32_t thirty = indexList.pushBack(30);
+    indexList.insertAfter(ten, 20);
+    indexList.pushFront(5);
+    indexList.erase(thirty);
+    indexList.pushBack(40); // Reuses the freed slot
+    cout << "Index list:            ";
+    indexList.printList();
+    cout << "Index list backward:   ";
+    for (uint32_t i = indexList.last(); i != IndexLinkedList::NIL; i = indexList.previous(i)) cout << indexList.value(i) << " ";
+    cout << endl;
+    indexList.compact();
+    cout << "After compact, first node is slot " << indexList.first() << ", last is slot " << indexList.last() << endl;
+
+    // Benchmark
+    const int N = 2000000;
+
+    long long before = heapBytesInUse();
+    DoublyNode *doublyHead = nullptr, *doublyTail = nullptr;
+    for (int i = 0; i < N; i++) {
+        DoublyNode *node = new DoublyNode{i, doublyTail, nullptr};
+        if (doublyTail) doublyTail->next = node;
+        else doublyHead = node;
+        doublyTail = node;
+    }
+    long long doublyBytes = heapBytesInUse() - before;
+
+    before = heapBytesInUse();
+    XorLinkedList *xorBench = new XorLinkedList();
+    for (int i = 0; i < N; i++) xorBench->pushBack(i);
+    long long xorBytes = heapBytesInUse() - before - (long long) sizeof(XorLinkedList);
+
+    IndexLinkedList indexBench;
+    indexBench.reserve(N);
+    for (int i = 0; i < N; i++) indexBench.pushBack(i);
+    long long indexBytes = (long long) indexBench.bytesReserved();
+
+    const int PASSES = 10;
+    double doublyTime = millisecondsFor([&]() {
+        for (int r = 0; r < PASSES; r++) {
+            long long total = 0;
+            for (DoublyNode *p = doublyHead; p; p = p->next) total += p->data;
+            for (DoublyNode *p = doublyTail; p; p = p->prev) total -= p->data;
+            compactSink = total;
+        }
+    });
+    double xorTime = millisecondsFor([&]() {
+        for (int r = 0; r < PASSES; r++) {
+            long long total = 0;
+            for (XorCursor f = xorBench->begin(); f.current; f = XorLinkedList::advance(f)) total += f.current->data;
+            for (XorCursor b = xorBench->rbegin(); b.current; b = XorLinkedList::advance(b)) total -= b.current->data;
+            compactSink = total;
+        }
+    });
+    double indexTime = millisecondsFor([&]() {
+        for (int r = 0; r < PASSES; r++) {
+            long long total = 0;
+            for (uint32_t i = indexBench.first(); i != IndexLinkedList::NIL; i = indexBench.next(i)) total += indexBench.value(i);
+            for (uint32_t i = indexBench.last(); i != IndexLinkedList::NIL; i = indexBench.previous(i)) total -= indexBench.value(i);
+            compactSink = total;
+        }
+    });
+
+    cout << "\nBenchmark with " << N << " nodes (" << PASSES << " forward + backward passes)" << endl;
+    cout << "                  sizeof(node)   heap bytes/node   traversal" << endl;
+    cout << "DoublyNode:       " << sizeof(DoublyNode) << "             " << (double) doublyBytes / N << "                " << doublyTime << " ms" << endl;
+    cout << "XorLinkedList:    " << sizeof(XorNode) << "             " << (double) xorBytes / N << "                " << xorTime << " ms" << endl;
+    cout << "IndexLinkedList:  " << IndexLinkedList::nodeBytes() << "             " << (double) indexBytes / N << "                " << indexTime << " ms" << endl;
+    if (before < 0) cout << "(heap bytes per node are only measured with glibc)" << endl;
+
+    while (doublyHead) {
+        DoublyNode *next = doublyHead->next;
+        delete doublyHead;
+        doublyHead = next;
+    }
+    delete xorBench;
+    return 0;
+}
@@ -0,0 +1,163 @@
+#include <iostream>
+#include <list>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+using namespace std;
+
+/*
+    Linked List Library.cpp sorts with `std::list::sort`. Merge sort is the natural sort for
+    linked lists: merging two sorted lists only relinks nodes, so no element is copied and no
+    buffer is needed. The sorts below are defined in Linked List Operations.cpp, as
+    LinkedList::mergeSort and LinkedList::sortViaArray over the node templates
+    bottomUpMergeSort and sortNodesViaArray; this program includes that file, explains them,
+    applies them to a doubly linked list and benchmarks them.
+
+    Bottom-up merge sort (no recursion, no length scan):
+        The top-down version first counts the nodes to find the middle, then recurses. This
+        version reads the list once from the front and keeps an array of sorted runs
+        (`bins`), where bins[k] is either empty or holds exactly 2^k nodes:
+            1. Take the next node as a run of length 1.
+            2. Merge it with bins[0], then the result with bins[1], and so on, like carrying
+               in a binary counter, until an empty bin is found; store the run there.
+            3. At the end, merge all bins together.
+        It needs 64 bin pointers of extra space, no recursion, and it never has to know the
+        length in advance. The merge is stable: equal values keep their original order.
+
+    For a doubly linked list, the nodes are sorted through their `next` pointers and the
+    `prev` pointers are rebuilt in one final pass.
+
+    Array mode:
+        When the nodes are scattered across memory, every step of a merge can be a cache miss.
+        sortViaArray first copies each node's value and address into a contiguous array, sorts
+        that array (with stable_sort, so ties keep their order), then relinks the nodes in the
+        sorted order in one pass. The sort then works on contiguous memory, at the cost of
+        O(n) extra space.
+
+    Time Complexity:
+        - O(n log n) for both modes, in every case.
+
+    Space Complexity:
+        - Bottom-up merge sort: O(1) (64 pointers), in place.
+        - Array mode: O(n) for the array.
+*/
+
+// LinkedList, its sorts and the node sort templates, without that program's main
+#define WITHOUT_MAIN
+#include "../2 Linked List Operations/Linked List Operations.cpp"
+#undef WITHOUT_MAIN
+
+// DoublyNode from Linked List and Types.cpp
+struct DoublyNode {
+    int data;
+    DoublyNode *prev;
+    DoublyNode *next;
+};
+
+/*
+    Bottom-up merge sort of a doubly linked list
+*/
+
+// Sorts a doubly linked list in place and rebuilds its prev pointers
+void mergeSort(DoublyNode *&head, DoublyNode *&tail) {
+    head = bottomUpMergeSort(head, tail);
+    DoublyNode *previous = nullptr;
+    for (DoublyNode *ptr = head; ptr; ptr = ptr->next) {
+        ptr->prev = previous;
+        previous = ptr;
+    }
+}
+
+/*
+    Benchmark
+*/
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+// Builds a list of n random values; when `scattered`, consecutive nodes are far apart in memory
+void buildList(LinkedList<> &list, int n, bool scattered, mt19937 &rng) {
+    for (int i = 0; i < n; i++) list.addAtEnd(new node((int) (rng() % 1000000)));
+    if (scattered) {
+        // Sorting random values leaves the nodes in random memory order; then refill with new values
+        list.mergeSort();
+        for (node *ptr = list.head; ptr; ptr = ptr->next) ptr->data = (int) (rng() % 1000000);
+    }
+}
+
+void buildStdList(list<int> &values, int n, bool scattered, mt19937 &rng) {
+    for (int i = 0; i < n; i++) values.push_back((int) (rng() % 1000000));
+    if (scattered) {
+        values.sort();
+        for (int &value : values) value = (int) (rng() % 1000000);
+    }
+}
+
+bool isSorted(const LinkedList<> &list) {
+    for (node *ptr = list.head; ptr && ptr->next; ptr = ptr->next) {
+        if (ptr->data > ptr->next->data) return false;
+    }
+    return true;
+}
+
+int main() {
+    // Singly linked list
+    LinkedList<> L;
+    for (int value : {31, 4, 88, 1, 4, 2, 42}) L.addAtEnd(value);
+    cout << "Before: ";
+    L.printList();
+    L.mergeSort();
+    cout << "After:  ";
+    L.printList();
+    cout << "Tail: " << L.tail->data << endl;
+
+    // Doubly linked list
+    DoublyNode *head = nullptr, *tail = nullptr;
+    for (int value : {30, 10, 50, 20, 40}) {
+        DoublyNode *n = new DoublyNode{value, tail, nullptr};
+        if (tail) tail->next = n;
+        else head = n;
+        tail = n;
+    }
+    mergeSort(head, tail);
+    cout << "Doubly forward:  ";
+    for (DoublyNode *p = head; p; p = p->next) cout << p->data << " ";
+    cout << "\nDoubly backward: ";
+    for (DoublyNode *p = tail; p; p = p->prev) cout << p->data << " ";
+    cout << endl;
+    while (head) {
+        DoublyNode *next = head->next;
+        delete head;
+        head = next;
+    }
+
+    // Benchmark
+    const int N = 2000000;
+    cout << "\nSorting " << N << " random values" << endl;
+    for (bool scattered : {false, true}) {
+        mt19937 rng(41);
+        LinkedList<> a, b;
+        list<int> c;
+        buildList(a, N, scattered, rng);
+        buildList(b, N, scattered, rng);
+        buildStdList(c, N, scattered, rng);
+
+        double bottomUp = millisecondsFor([&]() { a.mergeSort(); });
+        double viaArray = millisecondsFor([&]() { b.sortViaArray(); });
+        double standard = millisecondsFor([&]() { c.sort(); });
+
+        cout << (scattered ? "Nodes scattered in memory:" : "Nodes in allocation order:") << endl;
+        cout << "  bottom-up merge sort: " << bottomUp << " ms" << (isSorted(a) ? "" : " (NOT SORTED)") << endl;
+        cout << "  array mode:           " << viaArray << " ms" << (isSorted(b) ? "" : " (NOT SORTED)") << endl;
+        cout << "  std::list::sort:      " << standard << " ms" << endl;
+    }
+
+    return 0;
+}
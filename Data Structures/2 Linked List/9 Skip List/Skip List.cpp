@@ -0,0 +1,650 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+#include <new>
+using namespace std;
+
+/*
+    LinkedList::search in Linked List Operations.cpp is O(n): to find a key, every node before
+    it must be visited. A skip list keeps the list sorted and gives some nodes extra forward
+    pointers that skip over many nodes at once, forming "express lanes":
+
+        level 2:  head ------------------------> 30 ------------------------> NULL
+        level 1:  head --------> 10 -----------> 30 --------> 50 -----------> NULL
+        level 0:  head -> 5 -> 10 -> 20 -> 25 -> 30 -> 40 -> 50 -> 60 -> 70 -> NULL
+
+    A search starts on the highest level and moves right while the next key is smaller, then
+    drops one level. Level 0 is an ordinary sorted singly linked list, so iterating a range of
+    keys is a plain linked list traversal.
+
+    Node heights are random: a node reaches level k+1 with probability p = 1/2, so nodes
+    average 2 forward pointers. What a search costs on a large list is cache misses, about one
+    per node it reads. In the classic layout every comparison reads the next node's key,
+    including the last one on each level, which does not move: about 2.89 ln n node reads for
+    either p = 1/2 or p = 1/4. Here every forward pointer is a Link that also holds the key of
+    the node it points to, so a search compares against that copy and only reads the nodes it
+    moves to: (1 - p) / p moves on each of log_(1/p) n levels, which for p = 1/2 is about
+    1.44 ln n reads, half of the classic layout. Larger p would save a few more reads, but
+    every extra level costs a 16-byte Link in most nodes. Each node is allocated with exactly
+    as many links as its height, 12 + 16 * height bytes: 44 bytes on average.
+
+    Concurrent version:
+        ConcurrentSkipList is the lazy skip list of Herlihy, Lev, Luchangco and Shavit (2007):
+        - search takes no lock and writes nothing shared. It walks the links like the
+          sequential search and accepts a node only if it is fully linked and not marked.
+        - insert finds the predecessors on every level of the new node, locks them (bottom-up,
+          each node once) and checks that they are unmarked and still point at the expected
+          successors. It then links the node bottom-up and sets fullyLinked. If the check
+          fails, another thread changed that spot, and insert starts over.
+        - remove marks the node under its own lock (from then on the key is gone), then locks
+          and checks the predecessors the same way and unlinks the node top-down.
+        The lock is one byte in each node, so only operations on neighboring keys wait for each
+        other. A removed node may still be read by searches that reached it before, so it is
+        retired to the epoch-based reclamation of Lock-Free Linked List.cpp instead of being
+        freed. Range iteration is weakly consistent: keys inserted or removed during the walk
+        may or may not be seen.
+        Its links hold no key copy, since a (pointer, key) pair cannot be replaced with one
+        ordinary atomic store.
+
+    Time Complexity (expected):
+        - search, insert, remove: O(log n).
+        - Range iteration: O(log n + k) for k keys in the range.
+        - Worst case O(n), with vanishing probability.
+
+    Space Complexity:
+        - O(n): on average 1 / (1 - p) = 2 links per node.
+
+    Pros:
+        - Sorted order and O(log n) operations without rebalancing rotations (unlike AVL or
+          Red-Black trees); inserts only touch a node's neighbors.
+        - An update changes only a few local pointers, so concurrent updates lock only the
+          neighbors of their key.
+
+    Cons:
+        - Performance is probabilistic, not guaranteed.
+        - More pointer chasing than a B-tree or sorted array of the same size.
+
+    Note:
+        At most EpochReclamation::MAX_THREADS threads may use ConcurrentSkipList at a time.
+*/
+
+// Geometric node height with p = 1/2: one level per trailing zero bit of a random number
+int randomHeight(uint64_t &state, int maxLevel) {
+    state ^= state << 13; // xorshift64
+    state ^= state >> 7;
+    state ^= state << 17;
+    return 1 + __builtin_ctzll(state | (1ULL << (maxLevel - 1)));
+}
+
+class SkipList {
+private:
+    static const int MAX_LEVEL = 32; // 2^32 nodes are far beyond memory, so heights never need more
+
+    struct SkipNode;
+
+    // Forward pointer, with a copy of the key it points to so that a search need not read the node
+    struct Link {
+        SkipNode *node;
+        int key;
+    };
+
+    struct SkipNode {
+        int key;
+        int value;
+        int height;
+        Link next[1]; // Actually `height` links, allocated with the node
+    };
+
+    SkipNode *head; // Sentinel with MAX_LEVEL links and no key
+    int level;      // Highest level currently in use
+    int size;
+    uint64_t randomState;
+
+    static SkipNode *allocateNode(int key, int value, int height) {
+        size_t bytes = sizeof(SkipNode) + (height - 1) * sizeof(Link);
+        SkipNode *node = static_cast<SkipNode *>(operator new(bytes));
+        node->key = key;
+        node->value = value;
+        node->height = height;
+        for (int i = 0; i < height; i++) node->next[i] = Link{nullptr, 0};
+        return node;
+    }
+
+    static void freeNode(SkipNode *node) {
+        operator delete(node);
+    }
+
+    // Whether the search for `key` moves right from `node` on level i; reads only `node`
+    static bool goesRight(const SkipNode *node, int i, int key) {
+        return node->next[i].node && node->next[i].key < key;
+    }
+
+    // Fills `update[i]` with the last node before `key` on each level; returns the candidate node
+    SkipNode *findPredecessors(int key, SkipNode **update) const {
+        SkipNode *node = head;
+        for (int i = level - 1; i >= 0; i--) {
+            while (goesRight(node, i, key)) node = node->next[i].node;
+            update[i] = node;
+        }
+        return node->next[0].node;
+    }
+
+public:
+    SkipList(uint64_t seed = 88172645463325252ULL) {
+        head = allocateNode(0, 0, MAX_LEVEL);
+        level = 1;
+        size = 0;
+        randomState = seed ? seed : 1;
+    }
+
+    SkipList(const SkipList &) = delete;
+    SkipList &operator=(const SkipList &) = delete;
+
+    ~SkipList() {
+        SkipNode *node = head;
+        while (node) {
+            SkipNode *next = node->next[0].node;
+            freeNode(node);
+            node = next;
+        }
+    }
+
+    int countNodes() const { return size; }
+    bool isEmpty() const { return size == 0; }
+
+    // Returns a pointer to the value stored for `key`, or nullptr
+    int *search(int key) const {
+        SkipNode *node = head;
+        for (int i = level - 1; i >= 0; i--) {
+            while (goesRight(node, i, key)) node = node->next[i].node;
+        }
+        node = node->next[0].node;
+        return node && node->key == key ? &node->value : nullptr;
+    }
+
+    // Adds `key` with `value`; returns false (and updates the value) when the key exists
+    bool insert(int key, int value) {
+        SkipNode *update[MAX_LEVEL];
+        SkipNode *found = findPredecessors(key, update);
+        if (found && found->key == key) {
+            found->value = value;
+            return false;
+        }
+
+        int height = randomHeight(randomState, MAX_LEVEL);
+        if (height > level) {
+            for (int i = level; i < height; i++) update[i] = head;
+            level = height;
+        }
+        SkipNode *node = allocateNode(key, value, height);
+        for (int i = 0; i < height; i++) {
+            node->next[i] = update[i]->next[i];
+            update[i]->next[i] = Link{node, key};
+        }
+        size++;
+        return true;
+    }
+
+    // Removes `key`; returns false when it is not present
+    bool remove(int key) {
+        SkipNode *update[MAX_LEVEL];
+        SkipNode *found = findPredecessors(key, update);
+        if (!found || found->key != key) return false;
+
+        for (int i = 0; i < found->height; i++) update[i]->next[i] = found->next[i];
+        freeNode(found);
+        while (level > 1 && !head->next[level - 1].node) level--;
+        size--;
+        return true;
+    }
+
+    // Calls visit(key, value) for every key in [low, high], in increasing order
+    template <typename Visit>
+    void forEachInRange(int low, int high, Visit visit) const {
+        SkipNode *node = head;
+        for (int i = level - 1; i >= 0; i--) {
+            while (goesRight(node, i, low)) node = node->next[i].node;
+        }
+        for (node = node->next[0].node; node && node->key <= high; node = node->next[0].node) {
+            visit(node->key, node->value);
+        }
+    }
+
+    // Number of nodes with each height, to check the height distribution
+    vector<int> heightHistogram() const {
+        vector<int> histogram(MAX_LEVEL + 1, 0);
+        for (SkipNode *node = head->next[0].node; node; node = node->next[0].node) histogram[node->height]++;
+        return histogram;
+    }
+
+    void printList() const {
+        for (SkipNode *node = head->next[0].node; node; node = node->next[0].node) {
+            cout << node->key << "(h" << node->height << ") -> ";
+        }
+        cout << "NULL" << endl;
+    }
+};
+
+// EpochReclamation from Lock-Free Linked List.cpp, without that program's main
+#define WITHOUT_MAIN
+#include "../6 Lock-Free Linked List/Lock-Free Linked List.cpp"
+#undef WITHOUT_MAIN
+
+// Lazy skip list: searches take no locks, updates lock the predecessors of their key
+class ConcurrentSkipList {
+private:
+    static const int MAX_LEVEL = 32;
+
+    struct ConcurrentNode {
+        int key;
+        atomic<int> value;
+        uint8_t height;
+        atomic<bool> marked;      // Removed: the key is no longer in the set
+        atomic<bool> fullyLinked; // Linked on every level; until then the key is not yet in the set
+        atomic<bool> locked;
+        atomic<ConcurrentNode *> next[1]; // Actually `height` links, allocated with the node
+
+        void lock() {
+            while (locked.exchange(true, memory_order_acquire)) this_thread::yield();
+        }
+
+        void unlock() { locked.store(false, memory_order_release); }
+    };
+
+    ConcurrentNode *head; // Sentinel with MAX_LEVEL links and no key
+
+    static ConcurrentNode *allocateNode(int key, int value, int height) {
+        size_t bytes = sizeof(ConcurrentNode) + (height - 1) * sizeof(atomic<ConcurrentNode *>);
+        ConcurrentNode *node = static_cast<ConcurrentNode *>(operator new(bytes));
+        node->key = key;
+        new (&node->value) atomic<int>(value);
+        node->height = (uint8_t) height;
+        new (&node->marked) atomic<bool>(false);
+        new (&node->fullyLinked) atomic<bool>(false);
+        new (&node->locked) atomic<bool>(false);
+        for (int i = 0; i < height; i++) new (&node->next[i]) atomic<ConcurrentNode *>(nullptr);
+        return node;
+    }
+
+    static void freeNode(void *node) {
+        operator delete(node);
+    }
+
+    // Height for a new node, from a random state private to the calling thread
+    static int threadRandomHeight() {
+        static atomic<uint64_t> seeds(88172645463325252ULL);
+        thread_local uint64_t state = seeds.fetch_add(0x9E3779B97F4A7C15ULL);
+        return randomHeight(state, MAX_LEVEL);
+    }
+
+    // Fills `predecessors[i]` and `successors[i]` around `key` on every level; returns the
+    // highest level on which a node with `key` was found, or -1.
+    // Must run inside an EpochReclamation::Guard.
+    int find(int key, ConcurrentNode **predecessors, ConcurrentNode **successors) const {
+        int foundLevel = -1;
+        ConcurrentNode *predecessor = head;
+        for (int i = MAX_LEVEL - 1; i >= 0; i--) {
+            ConcurrentNode *current = predecessor->next[i].load(memory_order_acquire);
+            while (current && current->key < key) {
+                predecessor = current;
+                current = current->next[i].load(memory_order_acquire);
+            }
+            if (foundLevel == -1 && current && current->key == key) foundLevel = i;
+            predecessors[i] = predecessor;
+            successors[i] = current;
+        }
+        return foundLevel;
+    }
+
+    // Locks predecessors[0 .. height) bottom-up, each node once, and checks that they are
+    // unmarked and still link to successors[i]; returns false on a change. Every lock taken
+    // is released by unlockPredecessors(predecessors, lockedLevels).
+    static bool lockAndValidate(ConcurrentNode **predecessors, ConcurrentNode **successors, int height,
+                                bool successorsMustBeLive, int &lockedLevels) {
+        lockedLevels = 0;
+        for (int i = 0; i < height; i++) {
+            ConcurrentNode *predecessor = predecessors[i];
+            if (i == 0 || predecessor != predecessors[i - 1]) predecessor->lock();
+            lockedLevels = i + 1;
+            ConcurrentNode *successor = successors[i];
+            if (predecessor->marked.load() || predecessor->next[i].load(memory_order_acquire) != successor) return false;
+            if (successorsMustBeLive && successor && successor->marked.load()) return false;
+        }
+        return true;
+    }
+
+    static void unlockPredecessors(ConcurrentNode **predecessors, int lockedLevels) {
+        for (int i = 0; i < lockedLevels; i++) {
+            if (i == 0 || predecessors[i] != predecessors[i - 1]) predecessors[i]->unlock();
+        }
+    }
+
+public:
+    ConcurrentSkipList() {
+        head = allocateNode(0, 0, MAX_LEVEL);
+    }
+
+    ConcurrentSkipList(const ConcurrentSkipList &) = delete;
+    ConcurrentSkipList &operator=(const ConcurrentSkipList &) = delete;
+
+    // Frees the nodes still linked; no other thread may use the list any more
+    ~ConcurrentSkipList() {
+        ConcurrentNode *node = head;
+        while (node) {
+            ConcurrentNode *next = node->next[0].load();
+            freeNode(node);
+            node = next;
+        }
+    }
+
+    // Copies the value stored for `key` into `value`; returns false when the key is absent
+    bool search(int key, int &value) const {
+        EpochReclamation::Guard guard;
+        ConcurrentNode *predecessor = head;
+        for (int i = MAX_LEVEL - 1; i >= 0; i--) {
+            ConcurrentNode *current = predecessor->next[i].load(memory_order_acquire);
+            while (current && current->key < key) {
+                predecessor = current;
+                current = current->next[i].load(memory_order_acquire);
+            }
+            if (current && current->key == key) {
+                if (!current->fullyLinked.load() || current->marked.load()) return false;
+                value = current->value.load(memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool contains(int key) const {
+        int value;
+        return search(key, value);
+    }
+
+    // Adds `key` with `value`; returns false (and updates the value) when the key exists
+    bool insert(int key, int value = 0) {
+        EpochReclamation::Guard guard;
+        int height = threadRandomHeight();
+        ConcurrentNode *predecessors[MAX_LEVEL];
+        ConcurrentNode *successors[MAX_LEVEL];
+        while (true) {
+            int foundLevel = find(key, predecessors, successors);
+            if (foundLevel != -1) {
+                ConcurrentNode *found = successors[foundLevel];
+                if (!found->marked.load()) {
+                    while (!found->fullyLinked.load()) this_thread::yield(); // Its insert is finishing
+                    found->value.store(value, memory_order_relaxed);
+                    return false;
+                }
+                continue; // Being removed; once it is unlinked the key can be inserted
+            }
+
+            int lockedLevels;
+            if (!lockAndValidate(predecessors, successors, height, true, lockedLevels)) {
+                unlockPredecessors(predecessors, lockedLevels);
+                continue;
+            }
+            ConcurrentNode *node = allocateNode(key, value, height);
+            for (int i = 0; i < height; i++) node->next[i].store(successors[i], memory_order_relaxed);
+            for (int i = 0; i < height; i++) predecessors[i]->next[i].store(node, memory_order_release);
+            node->fullyLinked.store(true);
+            unlockPredecessors(predecessors, lockedLevels);
+            return true;
+        }
+    }
+
+    // Removes `key`; returns false when it is not present
+    bool remove(int key) {
+        EpochReclamation::Guard guard;
+        ConcurrentNode *predecessors[MAX_LEVEL];
+        ConcurrentNode *successors[MAX_LEVEL];
+        ConcurrentNode *victim = nullptr;
+        while (true) {
+            int foundLevel = find(key, predecessors, successors);
+            if (!victim) {
+                // Only a fully linked node found on its top level can be removed; anything
+                // else is a node whose insert or remove is still in progress
+                if (foundLevel == -1) return false;
+                ConcurrentNode *found = successors[foundLevel];
+                if (!found->fullyLinked.load() || found->height - 1 != foundLevel || found->marked.load()) return false;
+                found->lock();
+                if (found->marked.load()) {
+                    found->unlock();
+                    return false; // Another thread removed it first
+                }
+                found->marked.store(true);
+                victim = found;
+            }
+
+            int lockedLevels;
+            if (!lockAndValidate(predecessors, successors, victim->height, false, lockedLevels)) {
+                unlockPredecessors(predecessors, lockedLevels);
+                continue; // The marked victim stays ours; find its predecessors again
+            }
+            for (int i = victim->height - 1; i >= 0; i--) {
+                predecessors[i]->next[i].store(victim->next[i].load(memory_order_relaxed), memory_order_release);
+            }
+            victim->unlock();
+            unlockPredecessors(predecessors, lockedLevels);
+            EpochReclamation::retire(victim, freeNode);
+            return true;
+        }
+    }
+
+    // Calls visit(key, value) for the keys in [low, high], in increasing order; keys inserted
+    // or removed by other threads during the walk may or may not be visited
+    template <typename Visit>
+    void forEachInRange(int low, int high, Visit visit) const {
+        EpochReclamation::Guard guard;
+        ConcurrentNode *node = head;
+        for (int i = MAX_LEVEL - 1; i >= 0; i--) {
+            ConcurrentNode *current = node->next[i].load(memory_order_acquire);
+            while (current && current->key < low) {
+                node = current;
+                current = current->next[i].load(memory_order_acquire);
+            }
+        }
+        for (node = node->next[0].load(memory_order_acquire); node && node->key <= high; node = node->next[0].load(memory_order_acquire)) {
+            if (node->fullyLinked.load() && !node->marked.load()) visit(node->key, node->value.load(memory_order_relaxed));
+        }
+    }
+
+    // Keys in order; only meaningful while no other thread is modifying the list
+    vector<int> snapshot() const {
+        vector<int> keys;
+        forEachInRange(INT_MIN, INT_MAX, [&](int key, int) { keys.push_back(key); });
+        return keys;
+    }
+};
+
+// Binary Search Tree from Binary Search Tree.cpp, for comparison, without that program's main
+#define WITHOUT_MAIN
+#include "../../6 Binary Tree/2 Binary Search Tree/Binary Search Tree.cpp"
+#undef WITHOUT_MAIN
+
+// Search for a value in the BST (Binary Search Tree.cpp has no search)
+bool searchTree(Node* root, int val) {
+    while (root) {
+        if (val == root->data) return true;
+        root = val < root->data ? root->left : root->right;
+    }
+    return false;
+}
+
+// Baseline for the concurrent benchmark: the sequential SkipList behind one reader-writer lock
+class LockedSkipList {
+private:
+    SkipList list;
+    mutable shared_mutex lock;
+
+public:
+    bool contains(int key) const {
+        shared_lock<shared_mutex> guard(lock);
+        return list.search(key) != nullptr;
+    }
+
+    bool insert(int key, int value = 0) {
+        unique_lock<shared_mutex> guard(lock);
+        return list.insert(key, value);
+    }
+
+    bool remove(int key) {
+        unique_lock<shared_mutex> guard(lock);
+        return list.remove(key);
+    }
+};
+
+/*
+    Benchmark
+*/
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+volatile long long skipSink; // Keeps benchmarked results alive
+
+int main() {
+    SkipList skip;
+    for (int key : {30, 10, 50, 20, 40, 60, 70, 5, 25}) skip.insert(key, key * 100);
+    cout << "Skip list: ";
+    skip.printList();
+
+    int *value = skip.search(40);
+    cout << "search(40): " << (value ? to_string(*value) : "not found") << endl;
+    skip.remove(40);
+    cout << "After remove(40), search(40): " << (skip.search(40) ? "found" : "not found") << endl;
+    cout << "Keys in [10, 50]: ";
+    skip.forEachInRange(10, 50, [](int key, int) { cout << key << " "; });
+    cout << endl;
+
+    // Benchmark
+    const int N = 1000000;
+    mt19937 rng(53);
+    vector<int> keys(N);
+    for (int &key : keys) key = (int) (rng() % 1000000000);
+    vector<int> lookups(N);
+    for (int &key : lookups) key = rng() % 2 ? keys[rng() % N] : (int) (rng() % 1000000000);
+
+    SkipList list;
+    map<int, int> ordered;
+    Node *root = nullptr;
+
+    double skipInsert = millisecondsFor([&]() { for (int key : keys) list.insert(key, key); });
+    double mapInsert = millisecondsFor([&]() { for (int key : keys) ordered[key] = key; });
+    double treeInsert = millisecondsFor([&]() { for (int key : keys) root = insert(root, key); });
+
+    // Searches read but do not change the containers: best of interleaved rounds, less noisy
+    const int ROUNDS = 3;
+    double skipSearch = 1e300, mapSearch = 1e300, treeSearch = 1e300;
+    for (int round = 0; round < ROUNDS; round++) {
+        skipSearch = min(skipSearch, millisecondsFor([&]() {
+            long long found = 0;
+            for (int key : lookups) found += list.search(key) != nullptr;
+            skipSink = found;
+        }));
+        mapSearch = min(mapSearch, millisecondsFor([&]() {
+            long long found = 0;
+            for (int key : lookups) found += ordered.find(key) != ordered.end();
+            skipSink = found;
+        }));
+        treeSearch = min(treeSearch, millisecondsFor([&]() {
+            long long found = 0;
+            for (int key : lookups) found += searchTree(root, key);
+            skipSink = found;
+        }));
+    }
+
+    const int RANGES = 10000;
+    const int WIDTH = 1000000; // About 1000 keys per range
+    double skipRange = millisecondsFor([&]() {
+        long long total = 0;
+        for (int r = 0; r < RANGES; r++) {
+            int low = lookups[r];
+            list.forEachInRange(low, low + WIDTH, [&](int, int v) { total += v; });
+        }
+        skipSink = total;
+    });
+    double mapRange = millisecondsFor([&]() {
+        long long total = 0;
+        for (int r = 0; r < RANGES; r++) {
+            int low = lookups[r];
+            for (auto it = ordered.lower_bound(low); it != ordered.end() && it->first <= low + WIDTH; ++it) total += it->second;
+        }
+        skipSink = total;
+    });
+
+    double skipRemove = millisecondsFor([&]() { for (int key : keys) list.remove(key); });
+    double mapRemove = millisecondsFor([&]() { for (int key : keys) ordered.erase(key); });
+    deleteTree(root);
+
+    cout << "\nBenchmark with " << N << " random keys (ms)" << endl;
+    cout << "                 insert    search (best of " << ROUNDS << ")    " << RANGES << " ranges    remove" << endl;
+    cout << "SkipList:        " << skipInsert << "   " << skipSearch << "   " << skipRange << "   " << skipRemove << endl;
+    cout << "std::map:        " << mapInsert << "   " << mapSearch << "   " << mapRange << "   " << mapRemove << endl;
+    cout << "BST:             " << treeInsert << "   " << treeSearch << "   n/a (no range or delete in BST.cpp)" << endl;
+
+    // Height distribution: with p = 1/2 each level should hold about half of the one below
+    SkipList heights;
+    for (int i = 0; i < N; i++) heights.insert(i, i);
+    vector<int> histogram = heights.heightHistogram();
+    cout << "\nNode heights for " << N << " keys: ";
+    for (int h = 1; h < (int) histogram.size() && histogram[h] > 0; h++) cout << "h" << h << "=" << histogram[h] << " ";
+    cout << endl;
+
+    // Correctness under concurrency: every thread inserts its own keys, then removes the odd ones
+    {
+        ConcurrentSkipList shared;
+        const int THREADS = 4, PER_THREAD = 20000;
+        vector<thread> workers;
+        for (int t = 0; t < THREADS; t++) {
+            workers.emplace_back([&, t]() {
+                for (int i = 0; i < PER_THREAD; i++) shared.insert(i * THREADS + t, t);
+                for (int i = 1; i < PER_THREAD; i += 2) shared.remove(i * THREADS + t);
+            });
+        }
+        for (thread &worker : workers) worker.join();
+        vector<int> left = shared.snapshot();
+        bool ordered = is_sorted(left.begin(), left.end()) && adjacent_find(left.begin(), left.end()) == left.end();
+        cout << "\nConcurrent check: " << left.size() << " keys left (expected " << THREADS * PER_THREAD / 2
+             << "), sorted without duplicates: " << (ordered ? "yes" : "no") << endl;
+    }
+
+    // Mixed workloads (runWorkload from Lock-Free Linked List.cpp): search / insert / remove percentages
+    const int KEY_RANGE = 1000000;
+    const int OPERATIONS = 200000;
+    const int workloads[2][3] = {{90, 5, 5}, {50, 25, 25}};
+    cout << "\nMillion operations per second, keys in [0, " << KEY_RANGE << "), "
+         << thread::hardware_concurrency() << " hardware threads available" << endl;
+    for (const auto &mix : workloads) {
+        for (int threads : {1, 2, 4, 8}) {
+            ConcurrentSkipList lazy;
+            LockedSkipList locked;
+            for (int key = 0; key < KEY_RANGE; key += 2) {
+                lazy.insert(key);
+                locked.insert(key);
+            }
+            double lazyRate = runWorkload(lazy, threads, OPERATIONS, KEY_RANGE, mix[0], mix[1]);
+            double lockedRate = runWorkload(locked, threads, OPERATIONS, KEY_RANGE, mix[0], mix[1]);
+            cout << "  " << mix[0] << "/" << mix[1] << "/" << mix[2] << ", " << threads << " threads: "
+                 << "ConcurrentSkipList " << lazyRate << ", SkipList behind a shared_mutex " << lockedRate << endl;
+        }
+    }
+
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include <iostream>
+#include "../../Heap Allocator.h"
 using namespace std;
 
 /*
@@ -43,6 +44,9 @@ using namespace std;
         - The `Stack` class manages the linked list, with the `top` pointer representing the stack's top element.
         - Dynamic memory allocation is used to create and delete nodes as needed, ensuring efficient memory usage.
         - The destructor ensures all dynamically allocated nodes are properly deleted, preventing memory leaks.
+        - `push(value)` creates the new top node and `pop` destroys it through the `Allocator` template parameter: HeapAllocator
+          (Heap Allocator.h, `new` / `delete`) by default, a node pool in Node Pool Allocator.cpp. `pop` destroys whatever node is
+          on top, so a node handed to `push(Node*)` must have been created by the stack's own allocator.
 */
 
 
@@ -58,12 +62,14 @@ public:
     }
 };
 
+template <typename Allocator = HeapAllocator<Node>>
 class Stack {
 public:
     Node* top;  // Pointer to the top of the stack
+    Allocator allocator;  // Creates and destroys the nodes
 
     // Constructor to initialize the stack
-    Stack() {
+    Stack(Allocator allocator = Allocator()) : allocator(allocator) {
         top = nullptr;  // Start with an empty stack
     }
 
@@ -80,6 +86,11 @@ public:
         top = n;  // Update the top pointer to the new node
     }
 
+    // Push a new node holding `value`, created by the allocator
+    void push(int value) {
+        push(allocator.create(value));
+    }
+
     // Pop the top node from the stack
     void pop() {
         if (isEmpty()) {
@@ -88,7 +99,7 @@ public:
         }
         Node* n = top;  // Store the current top node
         top = top->next;  // Move top to the next node
-        delete n;  // Delete the old top node to free memory
+        allocator.destroy(n);  // Delete the old top node to free memory
     }
 
     // Check if the stack is empty
@@ -111,8 +122,9 @@ public:
     }
 };
 
+#ifndef WITHOUT_MAIN  // Node Pool Allocator.cpp and Growable Stack.cpp include this file for the Stack alone
 int main() {
-    Stack S;  // Create a stack object
+    Stack<> S;  // Create a stack object
 
     // Create nodes with data to push onto the stack
     Node* n1 = new Node(67);
@@ -140,3 +152,4 @@ int main() {
     // No need to explicitly delete nodes since the destructor handles it
     return 0;
 }
+#endif
@@ -0,0 +1,422 @@
+#include <iostream>
+#include <stack>
+#include <vector>
+#include <deque>
+#include <string>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <functional>
+using namespace std;
+
+/*
+    Stack of Array.cpp stores its elements in `int arr[MAX]` with MAX = 10: a full stack
+    prints "Stack is full!" and drops the push, and pop returns -1 on an empty stack, which
+    cannot be told apart from a real -1. Stack.cpp grows without limit but allocates a node
+    for every push.
+
+    GrowableStack<T> keeps the elements contiguous like the array version, but grows: when
+    the array is full it allocates one twice as large and moves the elements over. Doubling
+    means an element is moved about once on average (n + n/2 + n/4 + ... < 2n moves for n
+    pushes), so push is amortized O(1).
+
+    Errors are reported separately from the data:
+        - tryPop(out) / tryTop(out) return false on an empty stack and leave `out` alone.
+        - pop() and top() throw out_of_range on an empty stack.
+
+    Bulk operations:
+        - push_n(values, n) grows the storage at most once, then copies all n values (with
+          memcpy for trivially copyable types).
+        - pop_n(out, n) pops up to n values into `out`, top first, and returns how many.
+
+    Storage control:
+        - reserve(n) makes room for n elements up front; shrink_to_fit() releases unused
+          capacity, for example after a temporary spike.
+
+    Time Complexity:
+        - push / emplace: O(1) amortized, O(n) when the storage grows.
+        - pop, top, tryPop: O(1).
+        - push_n / pop_n: O(n) for n values.
+
+    Space Complexity:
+        - O(n), with up to 2x capacity after growing; shrink_to_fit trims it.
+*/
+
+template <typename T>
+class GrowableStack {
+private:
+    T *data;
+    size_t count;
+    size_t capacity;
+
+    static constexpr size_t INITIAL_CAPACITY = 16;
+
+    // Destroys items[0], ... items[n - 1]
+    static void destroyRange(T *items, size_t n) {
+        for (size_t i = 0; i < n; i++) items[i].~T();
+    }
+
+    // Moves the elements into a new array of `newCapacity` slots. If a copy throws, the new
+    // array is freed and the stack is left as it was
+    void reallocate(size_t newCapacity) {
+        T *fresh = static_cast<T *>(operator new(newCapacity * sizeof(T)));
+        if constexpr (is_trivially_copyable<T>::value) {
+            if (count) memcpy(fresh, data, count * sizeof(T));
+        } else {
+            size_t built = 0;
+            try {
+                for (; built < count; built++) new (fresh + built) T(move_if_noexcept(data[built]));
+            } catch (...) {
+                destroyRange(fresh, built);
+                operator delete(fresh);
+                throw;
+            }
+            destroyRange(data, count);
+        }
+        operator delete(data);
+        data = fresh;
+        capacity = newCapacity;
+    }
+
+    // Makes room for `extra` more elements, at least doubling the capacity
+    void grow(size_t extra) {
+        size_t needed = count + extra;
+        if (needed <= capacity) return;
+        size_t newCapacity = capacity ? capacity * 2 : INITIAL_CAPACITY;
+        if (newCapacity < needed) newCapacity = needed;
+        reallocate(newCapacity);
+    }
+
+public:
+    GrowableStack() : data(nullptr), count(0), capacity(0) {}
+
+    GrowableStack(const GrowableStack &) = delete;
+    GrowableStack &operator=(const GrowableStack &) = delete;
+
+    ~GrowableStack() {
+        clear();
+        operator delete(data);
+    }
+
+    bool isEmpty() const { return count == 0; }
+    size_t size() const { return count; }
+    size_t getCapacity() const { return capacity; }
+
+    void push(const T &item) {
+        if (count == capacity) {
+            T copy(item); // `item` may be an element of this stack, e.g. push(top())
+            grow(1);
+            new (data + count) T(move(copy));
+        } else {
+            new (data + count) T(item);
+        }
+        count++;
+    }
+
+    void push(T &&item) {
+        if (count == capacity) {
+            T moved(move(item)); // Taken out before grow() frees the storage `item` may live in
+            grow(1);
+            new (data + count) T(move(moved));
+        } else {
+            new (data + count) T(move(item));
+        }
+        count++;
+    }
+
+    // Constructs the new top element in place from `args`
+    template <typename... Args>
+    T &emplace(Args &&...args) {
+        T *slot;
+        if (count == capacity) {
+            T item(forward<Args>(args)...); // `args` may refer to elements of this stack
+            grow(1);
+            slot = new (data + count) T(move(item));
+        } else {
+            slot = new (data + count) T(forward<Args>(args)...);
+        }
+        count++;
+        return *slot;
+    }
+
+    // Pushes values[0], values[1], ... values[n - 1]; values[n - 1] ends on top
+    void push_n(const T *values, size_t n) {
+        if (count + n > capacity && less_equal<const T *>()(data, values) && less<const T *>()(values, data + count)) {
+            vector<T> copies(values, values + n); // `values` lies in the storage grow() frees
+            push_n(copies.data(), n);
+            return;
+        }
+        grow(n);
+        if constexpr (is_trivially_copyable<T>::value) {
+            if (n) memcpy(data + count, values, n * sizeof(T));
+        } else {
+            size_t built = 0;
+            try {
+                for (; built < n; built++) new (data + count + built) T(values[built]);
+            } catch (...) {
+                destroyRange(data + count, built); // Nothing is pushed if a copy throws
+                throw;
+            }
+        }
+        count += n;
+    }
+
+    // Top element; throws on an empty stack
+    T &top() {
+        if (isEmpty()) throw out_of_range("top on an empty stack");
+        return data[count - 1];
+    }
+
+    // Removes and returns the top element; throws on an empty stack
+    T pop() {
+        if (isEmpty()) throw out_of_range("pop on an empty stack");
+        T item = move(data[count - 1]);
+        data[--count].~T();
+        return item;
+    }
+
+    // Copies the top element into `out`; returns false on an empty stack
+    bool tryTop(T &out) const {
+        if (isEmpty()) return false;
+        out = data[count - 1];
+        return true;
+    }
+
+    // Moves the top element into `out` and removes it; returns false on an empty stack
+    bool tryPop(T &out) {
+        if (isEmpty()) return false;
+        out = move(data[count - 1]);
+        data[--count].~T();
+        return true;
+    }
+
+    // Pops up to n elements into out[0..], top first; returns how many were popped
+    size_t pop_n(T *out, size_t n) {
+        if (n > count) n = count;
+        for (size_t i = 0; i < n; i++) {
+            out[i] = move(data[count - 1 - i]);
+            data[count - 1 - i].~T();
+        }
+        count -= n;
+        return n;
+    }
+
+    void reserve(size_t n) {
+        if (n > capacity) reallocate(n);
+    }
+
+    // Releases unused capacity
+    void shrink_to_fit() {
+        if (count == capacity) return;
+        if (count == 0) {
+            operator delete(data);
+            data = nullptr;
+            capacity = 0;
+            return;
+        }
+        reallocate(count);
+    }
+
+    void clear() {
+        if constexpr (!is_trivially_destructible<T>::value) destroyRange(data, count);
+        count = 0;
+    }
+
+    // Print: Displays all elements from top to bottom
+    void print() const {
+        if (isEmpty()) {
+            cout << "Stack is empty!" << endl;
+            return;
+        }
+        for (size_t i = count; i-- > 0;) cout << data[i] << " ";
+        cout << endl;
+    }
+};
+
+// Node-based Stack from Stack.cpp, for comparison, without that program's main
+#define WITHOUT_MAIN
+#include "../1 Stack/Stack.cpp"
+#undef WITHOUT_MAIN
+
+/*
+    Benchmark
+*/
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+volatile long long stackSink; // Keeps benchmarked results alive
+
+// Fills a std::stack with n values and empties it again, `rounds` times
+template <typename Container>
+double standardPushPop(int n, int rounds) {
+    return millisecondsFor([&]() {
+        long long total = 0;
+        for (int r = 0; r < rounds; r++) {
+            stack<int, Container> s;
+            for (int i = 0; i < n; i++) s.push(i);
+            while (!s.empty()) {
+                total += s.top();
+                s.pop();
+            }
+        }
+        stackSink = total;
+    });
+}
+
+int main() {
+    GrowableStack<int> s;
+    for (int item : {11, 23, -8, 16, 27, 14, 20, 39, 2, 15, 7}) s.push(item); // No capacity limit
+    cout << "Stack contents (top to bottom): ";
+    s.print();
+
+    int popped[4];
+    size_t n = s.pop_n(popped, 4);
+    cout << "pop_n(4):";
+    for (size_t i = 0; i < n; i++) cout << " " << popped[i];
+    cout << endl;
+
+    int more[] = {100, 200, 300};
+    s.push_n(more, 3);
+    cout << "After push_n(100, 200, 300): ";
+    s.print();
+    cout << "Size " << s.size() << ", capacity " << s.getCapacity();
+    s.shrink_to_fit();
+    cout << ", after shrink_to_fit " << s.getCapacity() << endl;
+
+    GrowableStack<int> empty;
+    int value;
+    cout << "tryPop on an empty stack: " << (empty.tryPop(value) ? "popped" : "false") << endl;
+    try {
+        empty.pop();
+    } catch (const out_of_range &error) {
+        cout << "pop on an empty stack threw: " << error.what() << endl;
+    }
+
+    GrowableStack<pair<string, int>> frames;
+    frames.emplace("main", 1);
+    frames.emplace("parse", 12);
+    cout << "Top frame: " << frames.top().first << ":" << frames.top().second << endl;
+
+    // Benchmark: fill with N values and empty again
+    const int N = 1000000;
+    const int ROUNDS = 20;
+
+    double growable = millisecondsFor([&]() {
+        long long total = 0;
+        for (int r = 0; r < ROUNDS; r++) {
+            GrowableStack<int> g;
+            for (int i = 0; i < N; i++) g.push(i);
+            while (g.tryPop(value)) total += value;
+        }
+        stackSink = total;
+    });
+
+    double reserved = millisecondsFor([&]() {
+        long long total = 0;
+        for (int r = 0; r < ROUNDS; r++) {
+            GrowableStack<int> g;
+            g.reserve(N); // One allocation, no moves while filling
+            for (int i = 0; i < N; i++) g.push(i);
+            while (g.tryPop(value)) total += value;
+        }
+        stackSink = total;
+    });
+
+    vector<int> source(N);
+    for (int i = 0; i < N; i++) source[i] = i;
+    vector<int> sink(N);
+    double bulk = millisecondsFor([&]() {
+        long long total = 0;
+        for (int r = 0; r < ROUNDS; r++) {
+            GrowableStack<int> g;
+            g.push_n(source.data(), N);
+            g.pop_n(sink.data(), N);
+            total += sink[0];
+        }
+        stackSink = total;
+    });
+
+    double overVector = standardPushPop<vector<int>>(N, ROUNDS);
+    double overDeque = standardPushPop<deque<int>>(N, ROUNDS);
+
+    double nodes = millisecondsFor([&]() {
+        long long total = 0;
+        for (int r = 0; r < ROUNDS; r++) {
+            Stack<> nodeStack;
+            for (int i = 0; i < N; i++) nodeStack.push(i);
+            while (!nodeStack.isEmpty()) {
+                total += nodeStack.top->data;
+                nodeStack.pop();
+            }
+        }
+        stackSink = total;
+    });
+
+    // Steady state: the stack stays around the same depth, so no storage is allocated
+    const int OPERATIONS = 20000000;
+    GrowableStack<int> steady;
+    stack<int, vector<int>> steadyVector;
+    stack<int, deque<int>> steadyDeque;
+    for (int i = 0; i < 1000; i++) {
+        steady.push(i);
+        steadyVector.push(i);
+        steadyDeque.push(i);
+    }
+    double growableSteady = millisecondsFor([&]() {
+        long long total = 0;
+        for (int i = 0; i < OPERATIONS; i++) {
+            if (i & 1) total += steady.pop();
+            else steady.push(i);
+        }
+        stackSink = total;
+    });
+    double vectorSteady = millisecondsFor([&]() {
+        long long total = 0;
+        for (int i = 0; i < OPERATIONS; i++) {
+            if (i & 1) {
+                total += steadyVector.top();
+                steadyVector.pop();
+            } else {
+                steadyVector.push(i);
+            }
+        }
+        stackSink = total;
+    });
+    double dequeSteady = millisecondsFor([&]() {
+        long long total = 0;
+        for (int i = 0; i < OPERATIONS; i++) {
+            if (i & 1) {
+                total += steadyDeque.top();
+                steadyDeque.pop();
+            } else {
+                steadyDeque.push(i);
+            }
+        }
+        stackSink = total;
+    });
+
+    cout << "\nFill with " << N << " ints and empty, " << ROUNDS << " times (ms)" << endl;
+    cout << "GrowableStack push/tryPop:      " << growable << endl;
+    cout << "GrowableStack after reserve(N): " << reserved << endl;
+    cout << "GrowableStack push_n/pop_n:     " << bulk << endl;
+    cout << "std::stack over std::vector:    " << overVector << endl;
+    cout << "std::stack over std::deque:     " << overDeque << endl;
+    cout << "Node Stack from Stack.cpp:      " << nodes << endl;
+
+    cout << "\nAlternating push/pop, " << OPERATIONS << " operations (ms)" << endl;
+    cout << "GrowableStack:                  " << growableSteady << endl;
+    cout << "std::stack over std::vector:    " << vectorSteady << endl;
+    cout << "std::stack over std::deque:     " << dequeSteady << endl;
+
+    return 0;
+}
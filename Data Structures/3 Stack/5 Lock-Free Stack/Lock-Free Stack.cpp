@@ -0,0 +1,321 @@
+#include <iostream>
+#include <stack>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+using namespace std;
+
+/*
+    Stack::push(Node*) and Stack::pop() in Stack.cpp update `top` with plain assignments. If
+    two threads push at once, both read the same `top`, both link their node to it, and one
+    node is lost. This program implements a lock-free stack (Treiber, 1986) that many threads
+    can share, for example as a free list or a pool of work items.
+
+    Treiber stack:
+        push: read top, set node->next = top, then compare-and-swap (CAS) top from the value
+              read to the new node. If another thread changed top in between, the CAS fails
+              and the push retries.
+        pop:  read top, read top->next, then CAS top from the node read to its next.
+
+    The ABA problem:
+        Thread 1 reads top = A with next = B and is suspended. Thread 2 pops A, pops B and
+        pushes A again. The stack is now A -> C, but thread 1's CAS still sees top == A, so it
+        succeeds and sets top to B, a node that is no longer in the stack.
+
+        Here top is a 64-bit word holding a 32-bit node index and a 32-bit tag. Every
+        successful CAS increments the tag, so in the example top has changed from (A, 5) to
+        (A, 7), and thread 1's CAS fails. The same goes for the stack's internal free list of
+        nodes. A stale CAS could only succeed if exactly 2^32 operations happened while the
+        thread was suspended.
+
+        Using indices instead of pointers is what makes room for the tag in one word that any
+        64-bit CPU can CAS. Nodes are allocated in chunks and never freed while the stack
+        exists. They are recycled through the free list, so a thread reading a node that was
+        just popped by another thread still reads valid memory: no reclamation scheme is needed.
+
+    Elimination backoff (Hendler, Shavit and Yerushalmi, 2004):
+        Under heavy contention most CASes on top fail. A push followed by a pop leaves the
+        stack unchanged, so a push and a pop that collide can cancel each other out without
+        touching top at all. After a failed CAS, a thread visits a random slot of a small
+        elimination array:
+            - A pusher offers its node in an empty slot and waits a few moments. If a popper
+              takes it, both operations are done.
+            - A popper that finds an offered node takes it and returns its value.
+        If nothing happens the thread goes back to the stack. The more threads collide, the
+        more pairs are eliminated, so throughput holds up instead of collapsing.
+
+    Time Complexity:
+        - push, pop: O(1) plus retries; lock-free, so some thread always completes.
+
+    Space Complexity:
+        - O(n) for the largest number of elements ever held at once; nodes are reused.
+
+    Note:
+        The stack holds at most MAX_NODES elements, and values are copied, so T should be cheap
+        to copy (an index, a pointer, a small struct).
+        On a machine with a single hardware thread the threads never run at the same time, so
+        CASes almost never fail, no pairs are eliminated and both stacks run at the same
+        speed; the difference only appears with several cores.
+*/
+
+template <typename T>
+class LockFreeStack {
+private:
+    static const uint32_t NIL = 0xFFFFFFFF;
+    static const int CHUNK_BITS = 12;
+    static const uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+    static const uint32_t MAX_CHUNKS = 4096;
+    static const int ELIMINATION_SLOTS = 8;
+    static const int ELIMINATION_SPINS = 128; // How long a pusher waits for a popper
+
+    // Elimination slot markers; other values are offered node indices
+    static const uint32_t SLOT_EMPTY = NIL;
+    static const uint32_t SLOT_TAKEN = NIL - 1;
+
+public:
+    static const uint32_t MAX_NODES = CHUNK_SIZE * MAX_CHUNKS - 2; // Room for the two markers
+
+private:
+    struct Node {
+        T value;
+        atomic<uint32_t> next; // Atomic because a stale pop may read it while it is relinked
+    };
+
+    struct alignas(64) Slot { // One cache line per slot avoids false sharing
+        atomic<uint32_t> offer{SLOT_EMPTY};
+    };
+
+    alignas(64) atomic<uint64_t> top;       // (tag << 32) | index of the top node
+    alignas(64) atomic<uint64_t> freeTop;   // Same format, for nodes not in use
+    alignas(64) atomic<uint32_t> nextUnused; // First index never handed out
+    atomic<Node *> chunks[MAX_CHUNKS];
+    mutex chunkMutex; // Only taken to allocate a new chunk
+    Slot slots[ELIMINATION_SLOTS];
+    atomic<long long> eliminated;
+
+    static uint64_t pack(uint32_t index, uint32_t tag) { return ((uint64_t) tag << 32) | index; }
+    static uint32_t indexOf(uint64_t word) { return (uint32_t) word; }
+    static uint32_t tagOf(uint64_t word) { return (uint32_t) (word >> 32); }
+
+    Node &node(uint32_t index) {
+        return chunks[index >> CHUNK_BITS].load(memory_order_acquire)[index & (CHUNK_SIZE - 1)];
+    }
+
+    // Treiber push of node `index` onto the list headed by `head`; false if the CAS lost a race
+    bool tryPushIndex(atomic<uint64_t> &head, uint32_t index) {
+        uint64_t old = head.load(memory_order_relaxed);
+        node(index).next.store(indexOf(old), memory_order_relaxed);
+        return head.compare_exchange_weak(old, pack(index, tagOf(old) + 1), memory_order_release, memory_order_relaxed);
+    }
+
+    // Treiber pop from the list headed by `head`; stores the index (NIL when empty), false if the CAS lost a race
+    bool tryPopIndex(atomic<uint64_t> &head, uint32_t &index) {
+        uint64_t old = head.load(memory_order_acquire);
+        index = indexOf(old);
+        if (index == NIL) return true;
+        uint32_t next = node(index).next.load(memory_order_relaxed);
+        return head.compare_exchange_weak(old, pack(next, tagOf(old) + 1), memory_order_acquire, memory_order_relaxed);
+    }
+
+    // A node for a new element: recycled from the free list, or never used before
+    uint32_t allocateNode() {
+        uint32_t index;
+        while (!tryPopIndex(freeTop, index)) {
+        }
+        if (index != NIL) return index;
+
+        index = nextUnused.fetch_add(1, memory_order_relaxed);
+        if (index >= MAX_NODES) throw length_error("LockFreeStack is full");
+        uint32_t chunk = index >> CHUNK_BITS;
+        if (!chunks[chunk].load(memory_order_acquire)) {
+            lock_guard<mutex> guard(chunkMutex);
+            if (!chunks[chunk].load(memory_order_relaxed)) chunks[chunk].store(new Node[CHUNK_SIZE], memory_order_release);
+        }
+        return index;
+    }
+
+    void freeNode(uint32_t index) {
+        while (!tryPushIndex(freeTop, index)) {
+        }
+    }
+
+    static uint32_t randomSlot() {
+        thread_local uint32_t state = (uint32_t) hash<thread::id>()(this_thread::get_id()) | 1;
+        state ^= state << 13; // xorshift32
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state % ELIMINATION_SLOTS;
+    }
+
+    // Offers node `index` to a popper; true if one took it
+    bool eliminatePush(uint32_t index) {
+        Slot &slot = slots[randomSlot()];
+        uint32_t expected = SLOT_EMPTY;
+        if (!slot.offer.compare_exchange_strong(expected, index, memory_order_release, memory_order_relaxed)) return false;
+        for (int spin = 0; spin < ELIMINATION_SPINS; spin++) {
+            if (slot.offer.load(memory_order_acquire) == SLOT_TAKEN) break;
+        }
+        expected = index;
+        if (slot.offer.compare_exchange_strong(expected, SLOT_EMPTY, memory_order_relaxed)) return false; // Withdrawn
+        slot.offer.store(SLOT_EMPTY, memory_order_release); // A popper took the node
+        return true;
+    }
+
+    // Takes a node offered by a pusher; returns its index or NIL
+    uint32_t eliminatePop() {
+        Slot &slot = slots[randomSlot()];
+        uint32_t offered = slot.offer.load(memory_order_acquire);
+        if (offered == SLOT_EMPTY || offered == SLOT_TAKEN) return NIL;
+        if (!slot.offer.compare_exchange_strong(offered, SLOT_TAKEN, memory_order_acquire, memory_order_relaxed)) return NIL;
+        eliminated.fetch_add(1, memory_order_relaxed);
+        return offered;
+    }
+
+public:
+    LockFreeStack() : top(pack(NIL, 0)), freeTop(pack(NIL, 0)), nextUnused(0), eliminated(0) {
+        for (auto &chunk : chunks) chunk.store(nullptr, memory_order_relaxed);
+    }
+
+    LockFreeStack(const LockFreeStack &) = delete;
+    LockFreeStack &operator=(const LockFreeStack &) = delete;
+
+    // Frees all chunks; no other thread may use the stack any more
+    ~LockFreeStack() {
+        for (auto &chunk : chunks) delete[] chunk.load(memory_order_relaxed);
+    }
+
+    void push(const T &value) {
+        uint32_t index = allocateNode();
+        node(index).value = value;
+        while (!tryPushIndex(top, index)) {
+            if (eliminatePush(index)) return;
+        }
+    }
+
+    // Pops the top value into `out`; returns false when the stack is empty
+    bool tryPop(T &out) {
+        uint32_t index;
+        while (!tryPopIndex(top, index)) {
+            index = eliminatePop();
+            if (index != NIL) break;
+        }
+        if (index == NIL) return false;
+        out = node(index).value;
+        freeNode(index);
+        return true;
+    }
+
+    // Only a hint while other threads are pushing or popping
+    bool isEmpty() const {
+        return indexOf(top.load(memory_order_acquire)) == NIL;
+    }
+
+    // Number of push/pop pairs that met in the elimination array
+    long long eliminatedPairs() const {
+        return eliminated.load(memory_order_relaxed);
+    }
+};
+
+// std::stack protected by one mutex, for comparison
+template <typename T>
+class LockedStack {
+private:
+    stack<T, vector<T>> items;
+    mutex lock;
+
+public:
+    void push(const T &value) {
+        lock_guard<mutex> guard(lock);
+        items.push(value);
+    }
+
+    bool tryPop(T &out) {
+        lock_guard<mutex> guard(lock);
+        if (items.empty()) return false;
+        out = items.top();
+        items.pop();
+        return true;
+    }
+};
+
+/*
+    Benchmark
+*/
+
+atomic<long long> stackSink(0); // Keeps benchmarked results alive
+
+// Each of `threads` threads runs `operations` random pushes and pops; returns million operations per second
+template <typename Stack>
+double runWorkload(Stack &s, int threads, int operations) {
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            mt19937 rng(48 + t);
+            long long popped = 0;
+            int value;
+            for (int i = 0; i < operations; i++) {
+                if (rng() & 1) s.push(i);
+                else if (s.tryPop(value)) popped += value;
+            }
+            stackSink += popped;
+        });
+    }
+    for (thread &worker : workers) worker.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return threads * (double) operations / seconds / 1e6;
+}
+
+int main() {
+    LockFreeStack<int> s;
+    for (int value : {67, 42, 3}) s.push(value);
+    int value;
+    cout << "Popped:";
+    while (s.tryPop(value)) cout << " " << value;
+    cout << endl;
+
+    // Correctness under concurrency: every pushed value must be popped exactly once
+    const int THREADS = 8;
+    const int PER_THREAD = 100000;
+    LockFreeStack<int> shared;
+    vector<vector<int>> poppedBy(THREADS);
+    vector<thread> workers;
+    for (int t = 0; t < THREADS; t++) {
+        workers.emplace_back([&, t]() {
+            int v;
+            for (int i = 0; i < PER_THREAD; i++) {
+                shared.push(t * PER_THREAD + i);
+                if (shared.tryPop(v)) poppedBy[t].push_back(v);
+            }
+        });
+    }
+    for (thread &worker : workers) worker.join();
+    vector<int> all;
+    for (auto &values : poppedBy) all.insert(all.end(), values.begin(), values.end());
+    while (shared.tryPop(value)) all.push_back(value);
+    sort(all.begin(), all.end());
+    bool exact = (int) all.size() == THREADS * PER_THREAD;
+    for (int i = 0; exact && i < (int) all.size(); i++) exact = all[i] == i;
+    cout << "Concurrent check: " << all.size() << " values popped, each exactly once: " << (exact ? "yes" : "NO") << endl;
+
+    // Benchmark
+    const int OPERATIONS = 1000000;
+    cout << "\nMillion operations per second, 50% push / 50% pop, "
+         << thread::hardware_concurrency() << " hardware threads available" << endl;
+    for (int threads : {1, 2, 4, 8, 32}) {
+        LockFreeStack<int> lockFree;
+        LockedStack<int> locked;
+        double lockFreeRate = runWorkload(lockFree, threads, OPERATIONS);
+        double lockedRate = runWorkload(locked, threads, OPERATIONS);
+        cout << "  " << threads << " threads: LockFreeStack " << lockFreeRate << " (" << lockFree.eliminatedPairs()
+             << " eliminated pairs), mutex + std::stack " << lockedRate << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,427 @@
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+using namespace std;
+
+/*
+    The Stack classes in this folder belong to a single thread. In a parallel tree or graph
+    traversal each worker keeps its own stack of pending nodes (frames). Workers whose stacks run
+    dry must take work from busy workers, or the traversal ends up running on one thread.
+
+    Work-stealing deque (Chase and Lev, 2005), split into a private and a public part (as in
+    Lace, van Dijk and van de Pol, 2014):
+        Each worker owns one deque. The owner pushes and pops at the bottom, like a stack (LIFO,
+        so it keeps working depth-first on the freshest, cache-hot frames). Other threads
+        (thieves) take from the top, where the oldest frames are; in a tree traversal those are
+        the closest to the root and so usually the largest subtrees.
+
+            top (thieves steal here)     split                  head (owner pushes/pops here)
+               v                           v                      v
+             [ t | t+1 | ... | split-1 | split | ... | head-1 ]
+               public: thieves may take      private: only the owner
+
+        In the plain Chase-Lev deque every pop needs a full fence, because a thief may be taking
+        the same last elements. Here thieves only see [top, split), so the owner's private part
+        needs no synchronization at all:
+        - push: writes the slot and bumps head, a field only the owner touches.
+        - pop: while the private part is not empty, decrements head and reads the slot: no
+          fence and no atomic read-modify-write. Only when it is empty does pop take back the
+          newer half of the public part, with one CAS on top.
+        - steal: reads top and split, copies items from the top and claims them with one CAS
+          on top. When nothing is public it sets a request flag instead.
+        Both push and pop check the request flag with a relaxed load, a plain read. When a
+        thief has asked for work and private items remain, they publish the older half of
+        them with one release store of split.
+
+    Batched stealing:
+        Stealing one frame at a time means a thief soon comes back. stealBatch takes half of
+        the public frames (at most MAX_BATCH) with the same single CAS, so fewer steals are
+        needed.
+        A thief copies its items before the CAS, so the owner must make any copy of items it
+        takes back fail: when pop moves split down, it bumps a tag kept next to top with a CAS,
+        and every in-flight steal's CAS then fails. top is one 64-bit word: (tag << 32) | index.
+        The tag changes on every CAS, so a stale thief can never succeed (no ABA).
+
+    Growth:
+        The deque is a circular array that the owner doubles when it is full. Old arrays are kept
+        until the deque is destroyed, because a thief may still be copying from one.
+
+    Time Complexity:
+        - push: O(1) amortized (O(n) when the array doubles).
+        - pop: O(1); a CAS only when the private part is empty and items are public.
+        - stealBatch: O(k) for k stolen items; one CAS.
+
+    Space Complexity:
+        - O(n) for the array, plus the old arrays (together smaller than the current one).
+
+    Note:
+        Items are copied in and out through atomics, so T must be trivially copyable and
+        small: an index, a pointer, or a packed frame as in the demo below. The slots are
+        relaxed atomics, which compile to plain loads and stores.
+        A request is answered on the owner's next push or pop, so a busy owner never starves
+        thieves, whether it is pushing or draining its private part.
+*/
+
+template <typename T>
+class WorkStealingDeque {
+    static_assert(is_trivially_copyable<T>::value, "WorkStealingDeque items are copied through atomics");
+
+public:
+    static const int MAX_BATCH = 32;
+
+private:
+    struct Array {
+        uint32_t mask; // capacity - 1; capacity is a power of two
+        atomic<T> *slots;
+
+        Array(uint32_t capacity) : mask(capacity - 1), slots(new atomic<T>[capacity]) {}
+        ~Array() { delete[] slots; }
+
+        T get(uint32_t index) const { return slots[index & mask].load(memory_order_relaxed); }
+        void put(uint32_t index, T item) { slots[index & mask].store(item, memory_order_relaxed); }
+    };
+
+    // Shared with thieves
+    alignas(64) atomic<uint64_t> top; // (tag << 32) | index of the oldest item
+    alignas(64) atomic<uint32_t> split; // Index after the newest public item
+    atomic<bool> stealRequested; // Set by a thief that found nothing public
+    atomic<Array *> array;
+
+    // Only touched by the owner
+    alignas(64) uint32_t head; // Index after the newest item
+    uint32_t privateStart; // The owner's copy of split
+    uint32_t knownTop; // Index of top when the owner last read it; the real top is never lower
+    vector<Array *> retired;
+
+    static uint64_t pack(uint32_t index, uint32_t tag) { return ((uint64_t) tag << 32) | index; }
+    static uint32_t indexOf(uint64_t word) { return (uint32_t) word; }
+    static uint32_t tagOf(uint64_t word) { return (uint32_t) (word >> 32); }
+
+    // Doubles the array; items [t, b) are copied to the same indices
+    Array *grow(Array *old, uint32_t t, uint32_t b) {
+        Array *bigger = new Array((old->mask + 1) * 2);
+        for (uint32_t i = t; i != b; i++) bigger->put(i, old->get(i));
+        retired.push_back(old);
+        array.store(bigger, memory_order_release);
+        return bigger;
+    }
+
+    // Owner only: the array looked full; reads top again and doubles the array if it is.
+    // Kept out of line so that push stays small enough to inline
+    __attribute__((noinline)) Array *makeRoom(Array *a) {
+        knownTop = indexOf(top.load(memory_order_acquire));
+        if (head - knownTop > a->mask) a = grow(a, knownTop, head);
+        return a;
+    }
+
+    // Owner only: makes the older half of the private items public
+    void publish() {
+        privateStart += (head - privateStart + 1) / 2;
+        stealRequested.store(false, memory_order_relaxed);
+        split.store(privateStart, memory_order_release);
+    }
+
+    // Owner only: the private part is empty; takes back the newer half of the public part and
+    // pops from it; returns false when thieves have taken everything
+    bool reclaim(T &out) {
+        uint32_t end = privateStart; // No thief can take an item at or after end
+        uint64_t t = top.load(memory_order_acquire);
+        while (true) {
+            uint32_t tail = indexOf(t);
+            if (tail == end) return false;
+            uint32_t newSplit = tail + (end - tail) / 2;
+            split.store(newSplit, memory_order_relaxed);
+            // Bumping the tag fails every steal that read the old split
+            if (top.compare_exchange_weak(t, pack(tail, tagOf(t) + 1), memory_order_seq_cst, memory_order_acquire)) {
+                privateStart = newSplit;
+                knownTop = tail;
+                head--;
+                out = array.load(memory_order_relaxed)->get(head);
+                return true;
+            }
+            // A thief took a batch first (t now holds the new top); try again
+        }
+    }
+
+public:
+    WorkStealingDeque(uint32_t capacity = 1024)
+        : top(pack(0, 0)), split(0), stealRequested(false), head(0), privateStart(0), knownTop(0) {
+        uint32_t rounded = 2;
+        while (rounded < capacity) rounded *= 2;
+        array.store(new Array(rounded), memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+    WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+    ~WorkStealingDeque() {
+        delete array.load(memory_order_relaxed);
+        for (Array *old : retired) delete old;
+    }
+
+    // Owner only: pushes an item at the bottom
+    void push(T item) {
+        Array *a = array.load(memory_order_relaxed);
+        if (head - knownTop > a->mask) a = makeRoom(a);
+        a->put(head, item);
+        head++;
+        if (stealRequested.load(memory_order_relaxed)) publish();
+    }
+
+    // Owner only: pops the newest item; returns false when the deque is empty
+    bool pop(T &out) {
+        if (head != privateStart) { // Fast path: a private item
+            head--;
+            out = array.load(memory_order_relaxed)->get(head);
+            if (stealRequested.load(memory_order_relaxed) && head != privateStart) publish();
+            return true;
+        }
+        return reclaim(out);
+    }
+
+    // Any thread: steals up to half of the public items (at most `maxItems` and MAX_BATCH) from
+    // the top into `out`, oldest first; returns how many, 0 when nothing is public or when another
+    // thread got in first
+    int stealBatch(T *out, int maxItems) {
+        uint64_t t = top.load(memory_order_acquire);
+        uint32_t s = split.load(memory_order_acquire);
+        int32_t available = (int32_t) (s - indexOf(t));
+        if (available <= 0) {
+            requestItems();
+            return 0;
+        }
+
+        int n = min({(int) (available + 1) / 2, maxItems, MAX_BATCH});
+        Array *a = array.load(memory_order_acquire);
+        for (int i = 0; i < n; i++) out[i] = a->get(indexOf(t) + i);
+        if (!top.compare_exchange_strong(t, pack(indexOf(t) + n, tagOf(t) + 1), memory_order_seq_cst, memory_order_relaxed)) return 0;
+        return n;
+    }
+
+    // Any thread: steals the oldest public item
+    bool steal(T &out) {
+        return stealBatch(&out, 1) == 1;
+    }
+
+    // Any thread: asks the owner to publish part of its private items on its next push or pop
+    void requestItems() {
+        if (!stealRequested.load(memory_order_relaxed)) stealRequested.store(true, memory_order_relaxed);
+    }
+
+    // Any thread: whether items are public for thieves; only a hint while other threads run
+    bool stealable() const {
+        uint32_t t = indexOf(top.load(memory_order_acquire));
+        uint32_t s = split.load(memory_order_acquire);
+        return (int32_t) (s - t) > 0;
+    }
+};
+
+/*
+    Parallel depth-first search with work stealing
+*/
+
+// A frame of an implicit, irregular tree: node id and depth packed in 64 bits
+struct Frame {
+    uint32_t id;
+    uint32_t depth;
+};
+
+// Number of children of a node; the tree is unbalanced so that the work must be rebalanced
+int childCount(Frame frame, int maxDepth) {
+    if ((int) frame.depth >= maxDepth) return 0;
+    uint32_t h = frame.id * 2654435761u;
+    h ^= h >> 15;
+    return frame.depth < 4 ? 4 : (int) (h % 5); // 0 to 4 children, 2 on average
+}
+
+Frame childOf(Frame frame, int k) {
+    return Frame{frame.id * 5 + (uint32_t) k + 1, frame.depth + 1};
+}
+
+// Sequential DFS with a plain stack, for reference
+long long countNodesSerial(int maxDepth) {
+    vector<Frame> frames{Frame{0, 0}};
+    long long count = 0;
+    while (!frames.empty()) {
+        Frame frame = frames.back();
+        frames.pop_back();
+        count++;
+        int children = childCount(frame, maxDepth);
+        for (int k = 0; k < children; k++) frames.push_back(childOf(frame, k));
+    }
+    return count;
+}
+
+// Parallel DFS: every worker owns a deque, and idle workers steal batches from random victims
+long long countNodesParallel(int maxDepth, int workers, long long &steals) {
+    vector<WorkStealingDeque<Frame> *> deques;
+    for (int w = 0; w < workers; w++) deques.push_back(new WorkStealingDeque<Frame>());
+    deques[0]->push(Frame{0, 0});
+
+    // A worker counts as idle while it holds no frames; when all are idle the search is over
+    atomic<int> idle(0);
+    atomic<long long> total(0), stealCount(0);
+    vector<thread> threads;
+    for (int w = 0; w < workers; w++) {
+        threads.emplace_back([&, w]() {
+            WorkStealingDeque<Frame> &own = *deques[w];
+            mt19937 rng(49 + w);
+            long long count = 0, stolen = 0;
+            Frame frame;
+            Frame batch[WorkStealingDeque<Frame>::MAX_BATCH];
+            while (true) {
+                while (own.pop(frame)) {
+                    count++;
+                    int children = childCount(frame, maxDepth);
+                    for (int k = 0; k < children; k++) own.push(childOf(frame, k));
+                }
+
+                idle.fetch_add(1);
+                bool found = false;
+                while (!found && idle.load() < workers) {
+                    WorkStealingDeque<Frame> &victim = *deques[rng() % workers];
+                    if (&victim == &own || !victim.stealable()) {
+                        if (&victim != &own) victim.requestItems();
+                        this_thread::yield();
+                        continue;
+                    }
+                    idle.fetch_sub(1); // Not idle while holding stolen frames
+                    int n = victim.stealBatch(batch, WorkStealingDeque<Frame>::MAX_BATCH);
+                    if (n > 0) {
+                        stolen++;
+                        for (int i = 0; i < n; i++) own.push(batch[i]);
+                        found = true;
+                    } else {
+                        idle.fetch_add(1);
+                    }
+                }
+                if (!found) break;
+            }
+            total += count;
+            stealCount += stolen;
+        });
+    }
+    for (thread &t : threads) t.join();
+    for (auto *deque : deques) delete deque;
+    steals = stealCount;
+    return total;
+}
+
+/*
+    Benchmark
+*/
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+volatile long long dequeSink; // Keeps benchmarked results alive
+
+int main() {
+    WorkStealingDeque<int> deque(4);
+    for (int i = 1; i <= 9; i++) deque.push(i * 10); // Grows from 4 slots
+    int value;
+    deque.pop(value);
+    cout << "Owner pops the newest: " << value << endl;
+    int batch[WorkStealingDeque<int>::MAX_BATCH];
+    int n = deque.stealBatch(batch, WorkStealingDeque<int>::MAX_BATCH);
+    cout << "Thief finds " << n << " public items and asks for some" << endl;
+    deque.push(100); // Publishes the older half of the owner's items
+    n = deque.stealBatch(batch, WorkStealingDeque<int>::MAX_BATCH);
+    cout << "Thief steals " << n << " of the oldest:";
+    for (int i = 0; i < n; i++) cout << " " << batch[i];
+    cout << "\nLeft for the owner:";
+    while (deque.pop(value)) cout << " " << value;
+    cout << endl;
+
+    // Correctness under concurrency: the owner pushes and pops while thieves steal batches;
+    // every value must be taken exactly once
+    const int VALUES = 2000000;
+    const int THIEVES = 3;
+    WorkStealingDeque<int> shared;
+    vector<vector<int>> taken(THIEVES + 1);
+    atomic<bool> done(false);
+    vector<thread> thieves;
+    for (int t = 1; t <= THIEVES; t++) {
+        thieves.emplace_back([&, t]() {
+            int items[WorkStealingDeque<int>::MAX_BATCH];
+            while (!done.load() || shared.stealable()) {
+                int k = shared.stealBatch(items, WorkStealingDeque<int>::MAX_BATCH);
+                taken[t].insert(taken[t].end(), items, items + k);
+                if (k == 0) this_thread::yield();
+            }
+        });
+    }
+    for (int i = 0; i < VALUES; i++) {
+        shared.push(i);
+        if (i % 3 == 0 && shared.pop(value)) taken[0].push_back(value);
+    }
+    while (shared.pop(value)) taken[0].push_back(value);
+    done = true;
+    for (thread &thief : thieves) thief.join();
+    vector<int> all;
+    for (auto &values : taken) all.insert(all.end(), values.begin(), values.end());
+    sort(all.begin(), all.end());
+    bool exact = (int) all.size() == VALUES;
+    for (int i = 0; exact && i < VALUES; i++) exact = all[i] == i;
+    cout << "Concurrent check: " << all.size() << " values taken, each exactly once: " << (exact ? "yes" : "NO") << endl;
+
+    // Owner fast path against a plain vector used as a stack
+    const int OPERATIONS = 10000000;
+    WorkStealingDeque<int> owned;
+    vector<int> plain;
+    double dequeTime = millisecondsFor([&]() {
+        long long total = 0;
+        for (int i = 0; i < OPERATIONS; i++) {
+            owned.push(i);
+            owned.push(i);
+            owned.pop(value);
+            total += value;
+        }
+        while (owned.pop(value)) total += value;
+        dequeSink = total;
+    });
+    double vectorTime = millisecondsFor([&]() {
+        long long total = 0;
+        for (int i = 0; i < OPERATIONS; i++) {
+            plain.push_back(i);
+            plain.push_back(i);
+            total += plain.back();
+            plain.pop_back();
+        }
+        while (!plain.empty()) {
+            total += plain.back();
+            plain.pop_back();
+        }
+        dequeSink = total;
+    });
+    cout << "\nOwner push/push/pop x " << OPERATIONS << ": WorkStealingDeque " << dequeTime
+         << " ms, std::vector " << vectorTime << " ms" << endl;
+
+    // Parallel DFS over an irregular tree
+    const int MAX_DEPTH = 19;
+    long long serialCount = 0;
+    double serialTime = millisecondsFor([&]() { serialCount = countNodesSerial(MAX_DEPTH); });
+    cout << "\nDFS over an irregular tree, " << thread::hardware_concurrency() << " hardware threads available" << endl;
+    cout << "  serial:     " << serialCount << " nodes in " << serialTime << " ms" << endl;
+    for (int workers : {1, 2, 4, 8}) {
+        long long steals = 0, count = 0;
+        double parallelTime = millisecondsFor([&]() { count = countNodesParallel(MAX_DEPTH, workers, steals); });
+        cout << "  " << workers << " workers:  " << count << " nodes in " << parallelTime << " ms, " << steals
+             << " batch steals" << (count == serialCount ? "" : " (WRONG COUNT)") << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,381 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cmath>
+#include <stdexcept>
+using namespace std;
+
+/*
+    Stack Library.cpp and Stack of Array.cpp only push and pop fixed integers. A classic use of
+    stacks is evaluating expressions such as `price * quantity > 100 && region != 3`.
+
+    Reading the text each time an expression is evaluated is slow: the characters have to be
+    scanned, numbers parsed and operator precedence worked out, again and again. Here an
+    expression is compiled once into bytecode, and the bytecode can then be evaluated
+    millions of times with different variable values.
+
+    1. Compilation (shunting-yard, Dijkstra 1961):
+        Tokens are read left to right. Numbers and variables go straight to the output, and
+        operators wait on an operator stack until an operator of lower precedence (or a
+        closing parenthesis) arrives. The output is the expression in postfix order:
+
+            price * quantity > 100 && region != 3
+            ->  price quantity * 100 > region 3 != &&
+
+        Each postfix token becomes one 4-byte instruction (opcode + operand index), with
+        numbers kept in a constant pool. The compiler also works out how deep the value
+        stack can get.
+
+    2. Evaluation (stack virtual machine):
+        The instructions run in order on a stack of values: LOAD_CONST / LOAD_VAR push a
+        value, and an operator pops its operands and pushes the result. At the end the only
+        value left is the result. The stack is an array of fixed size on the C++ call stack,
+        like Stack of Array.cpp. Its depth was checked at compile time, so push and pop need no
+        bounds checks and evaluation never allocates.
+
+    Language:
+        - Numbers (double), variables named at compile time, parentheses.
+        - Arithmetic + - * / % and unary -, comparisons < <= > >= == !=, logical && || and !.
+          Comparisons and logic give 1 or 0; any nonzero value counts as true.
+        - Both sides of && and || are always evaluated (no short-circuit jumps).
+
+    Time Complexity:
+        - compile: O(n) for n characters.
+        - evaluate: O(k) for k instructions, with no allocation.
+
+    Space Complexity:
+        - O(k) bytecode and constants; the value stack holds at most MAX_DEPTH values.
+*/
+
+enum OpCode : uint8_t {
+    LOAD_CONST, LOAD_VAR,
+    ADD, SUB, MUL, DIV, MOD,
+    LESS, LESS_EQUAL, GREATER, GREATER_EQUAL, EQUAL, NOT_EQUAL,
+    AND, OR,
+    NEGATE, NOT
+};
+
+struct Instruction {
+    OpCode op;
+    uint8_t unused;
+    uint16_t arg; // Constant or variable index for LOAD_CONST / LOAD_VAR
+};
+
+// Array stack of doubles in the style of Stack of Array.cpp; bounds are checked by the compiler
+template <int MAX>
+class ValueStack {
+private:
+    double arr[MAX];
+    int top;
+
+public:
+    ValueStack() {
+        top = -1;
+    }
+
+    void push(double item) {
+        arr[++top] = item;
+    }
+
+    double pop() {
+        return arr[top--];
+    }
+
+    double &peek() {
+        return arr[top];
+    }
+};
+
+class CompiledExpression {
+public:
+    static const int MAX_DEPTH = 64; // Deepest value stack an expression may need
+
+private:
+    vector<Instruction> code;
+    vector<double> constants;
+    vector<string> variableNames;
+    int maxDepth = 0;
+
+    friend class ExpressionCompiler;
+
+public:
+    // Runs the bytecode with variables[i] as the value of the i-th variable name
+    double evaluate(const double *variables) const {
+        ValueStack<MAX_DEPTH> stack;
+        for (const Instruction &in : code) {
+            switch (in.op) {
+                case LOAD_CONST: stack.push(constants[in.arg]); break;
+                case LOAD_VAR: stack.push(variables[in.arg]); break;
+                case NEGATE: stack.peek() = -stack.peek(); break;
+                case NOT: stack.peek() = stack.peek() == 0; break;
+                default: {
+                    double right = stack.pop();
+                    double &left = stack.peek(); // The result replaces the left operand
+                    switch (in.op) {
+                        case ADD: left = left + right; break;
+                        case SUB: left = left - right; break;
+                        case MUL: left = left * right; break;
+                        case DIV: left = left / right; break;
+                        case MOD: left = fmod(left, right); break;
+                        case LESS: left = left < right; break;
+                        case LESS_EQUAL: left = left <= right; break;
+                        case GREATER: left = left > right; break;
+                        case GREATER_EQUAL: left = left >= right; break;
+                        case EQUAL: left = left == right; break;
+                        case NOT_EQUAL: left = left != right; break;
+                        case AND: left = (left != 0) && (right != 0); break;
+                        case OR: left = (left != 0) || (right != 0); break;
+                        default: break;
+                    }
+                }
+            }
+        }
+        return stack.pop();
+    }
+
+    double evaluate(const vector<double> &variables) const {
+        if (variables.size() < variableNames.size()) throw invalid_argument("missing variable values");
+        return evaluate(variables.data());
+    }
+
+    int instructionCount() const { return (int) code.size(); }
+    int stackDepth() const { return maxDepth; }
+
+    // Postfix form of the bytecode, for display
+    string disassemble() const {
+        static const char *names[] = {"", "", "+", "-", "*", "/", "%", "<", "<=", ">", ">=", "==", "!=", "&&", "||", "neg", "!"};
+        string text;
+        for (const Instruction &in : code) {
+            if (!text.empty()) text += " ";
+            if (in.op == LOAD_CONST) {
+                char buffer[32];
+                snprintf(buffer, sizeof buffer, "%g", constants[in.arg]);
+                text += buffer;
+            } else if (in.op == LOAD_VAR) {
+                text += variableNames[in.arg];
+            } else {
+                text += names[in.op];
+            }
+        }
+        return text;
+    }
+};
+
+// Shunting-yard compiler from infix text to CompiledExpression
+class ExpressionCompiler {
+private:
+    struct Operator {
+        OpCode op;
+        int precedence;
+    };
+
+    // Marker for "(" on the operator stack
+    static constexpr int PAREN = -1;
+
+    const string &text;
+    size_t pos = 0;
+    CompiledExpression result;
+    vector<Operator> operators;
+    int depth = 0;
+
+    [[noreturn]] void fail(const string &message) const {
+        throw invalid_argument(message + " at position " + to_string(pos) + " in \"" + text + "\"");
+    }
+
+    void emit(OpCode op, uint16_t arg = 0) {
+        result.code.push_back(Instruction{op, 0, arg});
+        if (op == LOAD_CONST || op == LOAD_VAR) depth++;
+        else if (op != NEGATE && op != NOT) depth--;
+        if (depth > result.maxDepth) result.maxDepth = depth;
+        if (depth > CompiledExpression::MAX_DEPTH) fail("expression too deeply nested");
+    }
+
+    // Emits the waiting operators that bind at least as tightly as `precedence`, down to a "("
+    void popOperators(int precedence) {
+        while (!operators.empty() && operators.back().precedence != PAREN && operators.back().precedence >= precedence) {
+            emit(operators.back().op);
+            operators.pop_back();
+        }
+    }
+
+    // Reads a binary operator at `pos`; returns false if there is none
+    bool readBinary(Operator &o) {
+        static const struct { const char *symbol; OpCode op; int precedence; } table[] = {
+            {"||", OR, 1}, {"&&", AND, 2}, {"==", EQUAL, 3}, {"!=", NOT_EQUAL, 3},
+            {"<=", LESS_EQUAL, 4}, {">=", GREATER_EQUAL, 4}, {"<", LESS, 4}, {">", GREATER, 4},
+            {"+", ADD, 5}, {"-", SUB, 5}, {"*", MUL, 6}, {"/", DIV, 6}, {"%", MOD, 6},
+        };
+        for (const auto &entry : table) {
+            size_t length = char_traits<char>::length(entry.symbol);
+            if (text.compare(pos, length, entry.symbol) == 0) {
+                o = Operator{entry.op, entry.precedence};
+                pos += length;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void skipSpaces() {
+        while (pos < text.size() && isspace((unsigned char) text[pos])) pos++;
+    }
+
+public:
+    ExpressionCompiler(const string &text, const vector<string> &variables) : text(text) {
+        result.variableNames = variables;
+    }
+
+    CompiledExpression compile() {
+        const int UNARY_PRECEDENCE = 7;
+        bool expectOperand = true; // True at the start, after an operator and after "("
+
+        while (skipSpaces(), pos < text.size()) {
+            char c = text[pos];
+            if (expectOperand) {
+                if (isdigit((unsigned char) c) || c == '.') {
+                    char *end;
+                    double value = strtod(text.c_str() + pos, &end);
+                    if (result.constants.size() > UINT16_MAX) fail("too many constants");
+                    result.constants.push_back(value);
+                    emit(LOAD_CONST, (uint16_t) (result.constants.size() - 1));
+                    pos = end - text.c_str();
+                    expectOperand = false;
+                } else if (isalpha((unsigned char) c) || c == '_') {
+                    size_t start = pos;
+                    while (pos < text.size() && (isalnum((unsigned char) text[pos]) || text[pos] == '_')) pos++;
+                    string name = text.substr(start, pos - start);
+                    size_t index = 0;
+                    while (index < result.variableNames.size() && result.variableNames[index] != name) index++;
+                    if (index == result.variableNames.size()) {
+                        pos = start;
+                        fail("unknown variable '" + name + "'");
+                    }
+                    emit(LOAD_VAR, (uint16_t) index);
+                    expectOperand = false;
+                } else if (c == '(') {
+                    operators.push_back(Operator{ADD, PAREN});
+                    pos++;
+                } else if (c == '-' || c == '!') {
+                    // Prefix operators wait until their operand is complete
+                    operators.push_back(Operator{c == '-' ? NEGATE : NOT, UNARY_PRECEDENCE});
+                    pos++;
+                } else if (c == '+') {
+                    pos++; // Unary plus changes nothing
+                } else {
+                    fail("expected a number, variable or '('");
+                }
+            } else if (c == ')') {
+                popOperators(0);
+                if (operators.empty()) fail("unmatched ')'");
+                operators.pop_back(); // The "("
+                pos++;
+            } else {
+                Operator o;
+                if (!readBinary(o)) fail("expected an operator or ')'");
+                popOperators(o.precedence); // Left-associative: equal precedence goes first
+                operators.push_back(o);
+                expectOperand = true;
+            }
+        }
+
+        if (expectOperand) fail("expression ends where an operand is expected");
+        while (!operators.empty()) {
+            if (operators.back().precedence == PAREN) fail("unmatched '('");
+            emit(operators.back().op);
+            operators.pop_back();
+        }
+        return result;
+    }
+};
+
+// Compiles `text`; variables are referred to by name and passed to evaluate() in this order
+CompiledExpression compileExpression(const string &text, const vector<string> &variables = {}) {
+    return ExpressionCompiler(text, variables).compile();
+}
+
+/*
+    Benchmark
+*/
+
+// Milliseconds elapsed while running `function`
+template <typename Function>
+double millisecondsFor(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+volatile double expressionSink; // Keeps benchmarked results alive
+
+int main() {
+    for (const char *text : {"1 + 2 * 3", "(1 + 2) * 3", "2 * -3 + 10 % 4", "!(3 < 2) && 5 >= 5", "10 / 4 - 1 / 2"}) {
+        CompiledExpression e = compileExpression(text);
+        cout << text << "  ->  [" << e.disassemble() << "]  =  " << e.evaluate(nullptr) << endl;
+    }
+
+    vector<string> names = {"price", "quantity", "region"};
+    CompiledExpression filter = compileExpression("price * quantity > 100 && region != 3", names);
+    cout << "\nFilter: [" << filter.disassemble() << "], " << filter.instructionCount() << " instructions, stack depth "
+         << filter.stackDepth() << endl;
+    cout << "price=12, quantity=10, region=1: " << filter.evaluate({12, 10, 1}) << endl;
+    cout << "price=12, quantity=10, region=3: " << filter.evaluate({12, 10, 3}) << endl;
+    cout << "price=5,  quantity=10, region=1: " << filter.evaluate({5, 10, 1}) << endl;
+
+    for (const char *bad : {"1 +", "(1 + 2", "1 + 2)", "price * 2", "3 $ 4"}) {
+        try {
+            compileExpression(bad);
+        } catch (const invalid_argument &error) {
+            cout << "Error: " << error.what() << endl;
+        }
+    }
+
+    // Benchmark: the same expression over many sets of variable values
+    const int EVALUATIONS = 10000000;
+    const string text = "(price * quantity - discount) / (1 + tax) > 100 && region != 3 || priority >= 8";
+    vector<string> variables = {"price", "quantity", "discount", "tax", "region", "priority"};
+    mt19937 rng(50);
+    const int ROWS = 1024;
+    vector<double> rows(ROWS * variables.size());
+    for (double &value : rows) value = rng() % 50;
+
+    CompiledExpression compiled = compileExpression(text, variables);
+    double compiledTime = millisecondsFor([&]() {
+        double total = 0;
+        for (int i = 0; i < EVALUATIONS; i++) total += compiled.evaluate(&rows[(i % ROWS) * variables.size()]);
+        expressionSink = total;
+    });
+
+    // Parsing the text every time, as an interpreter without bytecode would
+    const int REPARSES = EVALUATIONS / 20;
+    double reparseTime = millisecondsFor([&]() {
+        double total = 0;
+        for (int i = 0; i < REPARSES; i++) total += compileExpression(text, variables).evaluate(&rows[(i % ROWS) * variables.size()]);
+        expressionSink = total;
+    });
+
+    // The same expression written in C++, as the upper bound
+    double nativeTime = millisecondsFor([&]() {
+        double total = 0;
+        for (int i = 0; i < EVALUATIONS; i++) {
+            const double *v = &rows[(i % ROWS) * variables.size()];
+            total += ((v[0] * v[1] - v[2]) / (1 + v[3]) > 100 && v[4] != 3) || v[5] >= 8;
+        }
+        expressionSink = total;
+    });
+
+    cout << "\n\"" << text << "\"" << endl;
+    cout << "Bytecode: " << compiled.instructionCount() << " instructions of " << sizeof(Instruction) << " bytes, stack depth "
+         << compiled.stackDepth() << endl;
+    cout << "Million evaluations per second:" << endl;
+    cout << "  compiled once, bytecode VM:  " << EVALUATIONS / compiledTime / 1e3 << endl;
+    cout << "  parsed on every evaluation:  " << REPARSES / reparseTime / 1e3 << endl;
+    cout << "  native C++:                  " << EVALUATIONS / nativeTime / 1e3 << endl;
+
+    return 0;
+}
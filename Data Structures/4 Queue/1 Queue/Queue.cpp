@@ -1,4 +1,5 @@
 #include <iostream>
+#include "../../Heap Allocator.h"
 using namespace std;
 
 /*
@@ -41,6 +42,9 @@ using namespace std;
         - Each node contains an integer `data` and a pointer to the next node.
         - The `Queue` class manages the linked list, with `front` and `back` pointers representing both ends of the queue.
         - The destructor ensures all dynamically allocated nodes are properly deleted, preventing memory leaks.
+        - The `Allocator` template parameter owns the nodes: `enqueue(value)` allocates at the back, `dequeue` frees at the front.
+          It defaults to HeapAllocator from Heap Allocator.h (`new` / `delete`); Node Pool Allocator.cpp plugs in node pools.
+          A node linked in with `enqueue(Node*)` is freed by `dequeue` like any other, so it must come from the same allocator.
 */
 
 class Node {
@@ -55,13 +59,15 @@ public:
     }
 };
 
+template <typename Allocator = HeapAllocator<Node>>
 class Queue {
 public:
     Node* front;  // Pointer to the front of the queue
     Node* back;   // Pointer to the back of the queue
+    Allocator allocator;  // Creates and destroys the nodes
 
     // Constructor to initialize an empty queue
-    Queue() {
+    Queue(Allocator allocator = Allocator()) : allocator(allocator) {
         front = back = nullptr;
     }
 
@@ -87,6 +93,11 @@ public:
         }
     }
 
+    // Add a new node holding `value`, created by the allocator
+    void enqueue(int value) {
+        enqueue(allocator.create(value));
+    }
+
     // Remove the front node from the queue
     void dequeue() {
         if (isEmpty()) {
@@ -98,7 +109,7 @@ public:
         if (front == nullptr) {
             back = nullptr;  // If the queue becomes empty, reset `back`
         }
-        delete n;  // Free memory of the removed node
+        allocator.destroy(n);  // Free memory of the removed node
     }
 
     // Print all elements of the queue
@@ -116,8 +127,9 @@ public:
     }
 };
 
+#ifndef WITHOUT_MAIN  // Node Pool Allocator.cpp includes this file for the Queue alone
 int main() {
-    Queue Q;  // Create a queue object
+    Queue<> Q;  // Create a queue object
 
     // Create nodes with data to enqueue
     Node* n1 = new Node(7);
@@ -144,3 +156,4 @@ int main() {
 
     return 0;
 }
+#endif
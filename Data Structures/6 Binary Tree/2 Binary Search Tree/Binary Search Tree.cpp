@@ -1,4 +1,5 @@
 #include <iostream>
+#include "../../Heap Allocator.h"
 using namespace std;
 
 /*
@@ -46,6 +47,8 @@ using namespace std;
     - Maintains BST ordering automatically during insertion
     - Visualizes the tree in a rotated 2D format to show parent-child relationships
     - Recursively deletes all nodes for proper memory cleanup
+    - Creates and destroys nodes through an allocator argument: HeapAllocator (Heap Allocator.h,
+      `new` / `delete`) by default, the pool allocators of Node Pool Allocator.cpp otherwise
 
     Note: The tree may appear balanced depending on insertion order, but no self-balancing
     logic is implemented (e.g., AVL or Red-Black Tree).
@@ -62,12 +65,13 @@ class Node {
 };
 
 // Insert a new value into the BST
-Node* insert(Node* root, int val) {
-    if (!root) return new Node(val);
+template <typename Allocator = HeapAllocator<Node>>
+Node* insert(Node* root, int val, Allocator allocator = Allocator()) {
+    if (!root) return allocator.create(val);
     if (val < root->data)
-        root->left = insert(root->left, val);
+        root->left = insert(root->left, val, allocator);
     else
-        root->right = insert(root->right, val);
+        root->right = insert(root->right, val, allocator);
     return root;
 }
 
@@ -90,13 +94,15 @@ void print(Node* root, int space = 0, int type = 0) {
 }
 
 // Recursively delete all nodes in the tree
-void deleteTree(Node* node) {
+template <typename Allocator = HeapAllocator<Node>>
+void deleteTree(Node* node, Allocator allocator = Allocator()) {
     if (!node) return;
-    deleteTree(node->left);
-    deleteTree(node->right);
-    delete node;
+    deleteTree(node->left, allocator);
+    deleteTree(node->right, allocator);
+    allocator.destroy(node);
 }
 
+#ifndef WITHOUT_MAIN // Node Pool Allocator.cpp and Skip List.cpp include this file for the tree functions alone
 int main() {
     Node* root = nullptr;
 
@@ -128,3 +134,4 @@ int main() {
 
     return 0;
 }
+#endif
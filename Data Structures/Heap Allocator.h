@@ -0,0 +1,25 @@
+#ifndef HEAP_ALLOCATOR_H
+#define HEAP_ALLOCATOR_H
+
+#include <utility>
+
+/*
+    Default node allocator of the node-based containers: LinkedList (Linked List
+    Operations.cpp), Stack, Queue and the Binary Search Tree functions. An allocator is a small
+    copyable handle offering `create(args...)` and `destroy(node)`; this one is plain `new` and
+    `delete`, and Node Pool Allocator.cpp passes pool allocators with the same interface.
+
+    A program that includes several of those files, each in a namespace of its own, must
+    include this header at global scope first, so that they all share this one class.
+*/
+
+template <typename T>
+class HeapAllocator {
+public:
+    template <typename... Args>
+    T* create(Args&&... args) { return new T(std::forward<Args>(args)...); }
+
+    void destroy(T* n) { delete n; }
+};
+
+#endif